@@ -11,9 +11,220 @@
 #include <iomanip>
 #include <algorithm>
 #include <cmath> // For std::round
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <deque>
+#include <new>
+#include <tuple>
+#include <ctime>
+#include <filesystem>
+#include <memory>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace std;
 
+// Tracing
+
+/**
+ * @struct TraceEvent
+ * @brief One completed span, timed in nanoseconds since the tracer started.
+ */
+struct TraceEvent {
+    const char* name;
+    uint64_t startNs;
+    uint64_t durationNs;
+    int arg; // Optional span argument (e.g. the new state), -1 when unused
+};
+
+/**
+ * @struct TraceBuffer
+ * @brief Fixed-size ring of spans owned by one thread. Only the owning thread writes; the
+ *        release store of the write count lets a dumper read completed slots without locks.
+ */
+struct TraceBuffer {
+    static const size_t CAPACITY = 1 << 14;
+    TraceEvent events[CAPACITY];
+    atomic<uint64_t> written{0};
+    int threadID = 0;
+
+    void push(const TraceEvent& event) {
+        uint64_t count = written.load(memory_order_relaxed);
+        // Pairs with the dumper's fence: seeing any part of this write implies seeing written == count
+        atomic_thread_fence(memory_order_release);
+        events[count & (CAPACITY - 1)] = event;
+        written.store(count + 1, memory_order_release);
+    }
+};
+
+/**
+ * @class Tracer
+ * @brief Process-wide switch and registry for per-thread trace buffers, dumped as
+ *        Chrome/Perfetto trace JSON (load it in chrome://tracing or ui.perfetto.dev).
+ */
+class Tracer {
+public:
+    static bool isEnabled() {
+        return enabledFlag().load(memory_order_relaxed);
+    }
+
+    // Turns tracing on and dumps to filename when the process exits
+    static void start(const string& filename) {
+        // Construct the statics first so they are still alive when the exit dump runs
+        outputPath() = filename;
+        epoch();
+        registryMutex();
+        registry();
+        enabledFlag().store(true, memory_order_relaxed);
+        atexit([]() { dump(outputPath()); });
+    }
+
+    static const string& defaultPath() {
+        return outputPath();
+    }
+
+    static uint64_t nowNs() {
+        return (uint64_t)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - epoch()).count();
+    }
+
+    static TraceBuffer& threadBuffer() {
+        thread_local TraceBuffer* buffer = registerThread();
+        return *buffer;
+    }
+
+    static bool dump(const string& filename) {
+        ofstream file(filename);
+        if (!file.is_open()) return false;
+
+        file << fixed << setprecision(3) << "{\"traceEvents\":[";
+        bool first = true;
+        lock_guard<mutex> lock(registryMutex());
+        for (const auto& buffer : registry()) {
+            uint64_t end = buffer->written.load(memory_order_acquire);
+            uint64_t begin = end > TraceBuffer::CAPACITY ? end - TraceBuffer::CAPACITY : 0;
+            for (uint64_t i = begin; i < end; ++i) {
+                TraceEvent event = buffer->events[i & (TraceBuffer::CAPACITY - 1)];
+                // Skip slots the owner may have overwritten while we were copying. The owner is
+                // rewriting slot i once written reaches i + CAPACITY, and the fence keeps the copy
+                // above from being reordered after this re-check.
+                atomic_thread_fence(memory_order_acquire);
+                if (buffer->written.load(memory_order_relaxed) - i >= TraceBuffer::CAPACITY) continue;
+
+                file << (first ? "" : ",") << "\n{\"name\":\"" << event.name << "\",\"cat\":\"transcript\",\"ph\":\"X\""
+                     << ",\"ts\":" << event.startNs / 1000.0 << ",\"dur\":" << event.durationNs / 1000.0
+                     << ",\"pid\":1,\"tid\":" << buffer->threadID;
+                if (event.arg >= 0) {
+                    file << ",\"args\":{\"value\":" << event.arg << "}";
+                }
+                file << "}";
+                first = false;
+            }
+        }
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return true;
+    }
+
+private:
+    static atomic<bool>& enabledFlag() {
+        static atomic<bool> enabled(false);
+        return enabled;
+    }
+
+    static string& outputPath() {
+        static string path = "transcript_trace.json";
+        return path;
+    }
+
+    static chrono::steady_clock::time_point epoch() {
+        static const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        return start;
+    }
+
+    static mutex& registryMutex() {
+        static mutex registryLock;
+        return registryLock;
+    }
+
+    // Buffers outlive their threads so spans from finished workers still make it into dumps
+    static vector<unique_ptr<TraceBuffer>>& registry() {
+        static vector<unique_ptr<TraceBuffer>> buffers;
+        return buffers;
+    }
+
+    static TraceBuffer* registerThread() {
+        lock_guard<mutex> lock(registryMutex());
+        registry().push_back(make_unique<TraceBuffer>());
+        registry().back()->threadID = (int)registry().size();
+        return registry().back().get();
+    }
+};
+
+/**
+ * @class TraceSpan
+ * @brief Scoped span; while tracing is off it costs one well-predicted flag test.
+ */
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* spanName, int spanArg = -1) {
+        if (Tracer::isEnabled()) {
+            name = spanName;
+            arg = spanArg;
+            startNs = Tracer::nowNs();
+        }
+    }
+
+    ~TraceSpan() {
+        if (name) {
+            Tracer::threadBuffer().push({name, startNs, Tracer::nowNs() - startNs, arg});
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name = nullptr;
+    uint64_t startNs = 0;
+    int arg = -1;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(...) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(__VA_ARGS__)
+
+
+/**
+ * Letter grade to grade points. W and P carry -1.0 so GPA calculations skip them.
+ */
+const map<string, double>& gradePointTable() {
+    static const map<string, double> gradeMap = {
+        {"A", 4.0}, {"A+", 4.0}, {"A-", 3.7},
+        {"B+", 3.3}, {"B", 3.0}, {"B-", 2.7},
+        {"C+", 2.3}, {"C", 2.0}, {"C-", 1.7},
+        {"D+", 1.3}, {"D", 1.0}, {"D-", 0.7},
+        {"F", 0.0}, {"W", -1.0}, {"P", -1.0} 
+    };
+    return gradeMap;
+}
 
 /**
  * @struct Course
@@ -26,13 +237,7 @@ struct Course {
     string grade;
 
     double getGradePoints() const {
-        static const map<string, double> gradeMap = {
-            {"A", 4.0}, {"A+", 4.0}, {"A-", 3.7},
-            {"B+", 3.3}, {"B", 3.0}, {"B-", 2.7},
-            {"C+", 2.3}, {"C", 2.0}, {"C-", 1.7},
-            {"D+", 1.3}, {"D", 1.0}, {"D-", 0.7},
-            {"F", 0.0}, {"W", -1.0}, {"P", -1.0} 
-        };
+        const map<string, double>& gradeMap = gradePointTable();
 
         auto it = gradeMap.find(grade);
         if (it != gradeMap.end()) {
@@ -42,6 +247,15 @@ struct Course {
     }
 };
 
+// GPA arithmetic below is kept free of fused multiply-adds, whatever the compiler flags, so the
+// member functions, the cohort kernels and the benchmark baseline round identically
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
 /**
  * @struct Semester
  * @brief Represents a single semester, containing a list of courses.
@@ -51,6 +265,7 @@ struct Semester {
     vector<Course> courses;
 
     double calculateSemesterGPA() const {
+        TRACE_SCOPE("calculateSemesterGPA");
         double totalPoints = 0.0;
         int totalCredits = 0;
 
@@ -93,6 +308,118 @@ struct Semester {
     }
 };
 
+// GPA Policies
+
+/**
+ * @struct CourseAttempt
+ * @brief One attempt at a course as seen by a GPA policy.
+ */
+struct CourseAttempt {
+    const string* semesterID;
+    const Course* course;
+    double points;   // Grade points, -1.0 for W/P
+    bool passFail;   // Grade was "P"
+    int sequence;    // Encounter order within the transcript
+};
+
+/**
+ * @struct GPATotals
+ * @brief Running quality points and credits accumulated by a GPA policy.
+ */
+struct GPATotals {
+    double totalPoints = 0.0;
+    int totalCredits = 0;   // Credits that count toward the GPA
+    int earnedCredits = 0;  // Credits earned with a passing letter grade
+    int passFailCredits = 0;
+
+    // Branch-free: W/P attempts contribute zero through the mask. Policies that count several
+    // attempts of one course pass earnsCredit only for the attempt that earns its credits.
+    void addAttempt(const CourseAttempt& attempt, bool earnsCredit = true) {
+        int credits = attempt.course->credits;
+        int graded = attempt.points >= 0;
+        totalPoints += graded ? attempt.points * credits : 0.0;
+        totalCredits += graded * credits;
+        earnedCredits += (earnsCredit && attempt.points > 0) * credits;
+        passFailCredits += (earnsCredit && attempt.passFail) * credits;
+    }
+
+    int creditsEarned() const {
+        return earnedCredits + passFailCredits;
+    }
+
+    double gpa() const {
+        if (totalCredits == 0) {
+            return 0.0;
+        }
+        return totalPoints / totalCredits;
+    }
+};
+
+/**
+ * @struct LatestAttemptPolicy
+ * @brief The latest attempt of a course code wins (ties keep the first attempt seen).
+ */
+struct LatestAttemptPolicy {
+    static const CourseAttempt* select(const CourseAttempt* first, const CourseAttempt* last) {
+        const CourseAttempt* pick = last - 1;
+        while (pick != first && *(pick - 1)->semesterID == *pick->semesterID) {
+            --pick;
+        }
+        return pick;
+    }
+    static void accumulate(const CourseAttempt* first, const CourseAttempt* last, GPATotals& totals) {
+        totals.addAttempt(*select(first, last));
+    }
+    static void finish(GPATotals&) {}
+};
+
+/**
+ * @struct BestAttemptPolicy
+ * @brief The highest graded attempt of a course code counts (ties go to the latest).
+ */
+struct BestAttemptPolicy {
+    static void accumulate(const CourseAttempt* first, const CourseAttempt* last, GPATotals& totals) {
+        const CourseAttempt* pick = first;
+        for (const CourseAttempt* it = first + 1; it != last; ++it) {
+            pick = it->points >= pick->points ? it : pick;
+        }
+        totals.addAttempt(*pick);
+    }
+    static void finish(GPATotals&) {}
+};
+
+/**
+ * @struct AverageRepeatsPolicy
+ * @brief Every attempt of a repeated course counts, averaging repeats into the GPA.
+ *        The course's credits are earned once, on its first passing attempt.
+ */
+struct AverageRepeatsPolicy {
+    static void accumulate(const CourseAttempt* first, const CourseAttempt* last, GPATotals& totals) {
+        bool earned = false;
+        for (const CourseAttempt* it = first; it != last; ++it) {
+            bool passing = it->points > 0 || it->passFail;
+            totals.addAttempt(*it, passing && !earned);
+            earned = earned || passing;
+        }
+    }
+    static void finish(GPATotals&) {}
+};
+
+/**
+ * @struct PassFailCapPolicy
+ * @brief Wraps another policy and caps how many pass/fail credits count as earned.
+ */
+template <class AttemptPolicy, int MaxPassFailCredits>
+struct PassFailCapPolicy {
+    static void accumulate(const CourseAttempt* first, const CourseAttempt* last, GPATotals& totals) {
+        AttemptPolicy::accumulate(first, last, totals);
+    }
+    static void finish(GPATotals& totals) {
+        AttemptPolicy::finish(totals);
+        totals.passFailCredits = min(totals.passFailCredits, MaxPassFailCredits);
+    }
+};
+
 /**
  * @class Transcript
  * @brief Manages the student's entire academic record.
@@ -123,45 +450,77 @@ public:
         return false;
     }
 
-    double calculateCumulativeGPA() const {
-        map<string, pair<string, Course>> latestCourses;
+    /**
+     * Evaluates the transcript under a compile-time GPA policy. Attempts are grouped by course
+     * code (in course-code order, semesters ascending within a group) and each group is handed
+     * to Policy::accumulate, so every institutional rule compiles to its own loop.
+     */
+    /**
+     * Every course attempt in course-code order (semesters ascending within a code, ties in
+     * encounter order). Sequence numbers count courses in semester/course order.
+     */
+    vector<CourseAttempt> collectAttempts() const {
+        size_t courseCount = 0;
+        for (const auto& semester : semesters) {
+            courseCount += semester.courses.size();
+        }
 
+        vector<CourseAttempt> attempts;
+        attempts.reserve(courseCount);
+        int sequence = 0;
         for (const auto& semester : semesters) {
             for (const auto& course : semester.courses) {
-                if (latestCourses.find(course.courseCode) == latestCourses.end()) {
-                    latestCourses[course.courseCode] = {semester.semesterID, course};
-                } else {
-                    string existingSemesterID = latestCourses[course.courseCode].first;
-                    if (semester.semesterID > existingSemesterID) {
-                        latestCourses[course.courseCode] = {semester.semesterID, course};
-                    }
-                }
+                attempts.push_back({&semester.semesterID, &course, course.getGradePoints(), course.grade == "P", sequence++});
             }
         }
 
-        double totalPoints = 0.0;
-        int totalCredits = 0;
+        // Sequence breaks ties so equal semester IDs keep their encounter order
+        sort(attempts.begin(), attempts.end(), [](const CourseAttempt& a, const CourseAttempt& b) {
+            int byCode = a.course->courseCode.compare(b.course->courseCode);
+            if (byCode != 0) return byCode < 0;
+            int bySemester = a.semesterID->compare(*b.semesterID);
+            if (bySemester != 0) return bySemester < 0;
+            return a.sequence < b.sequence;
+        });
+        return attempts;
+    }
 
-        for (const auto& pair : latestCourses) {
-            const Course& course = pair.second.second;
-            double points = course.getGradePoints();
-            
-            if (points >= 0) {
-                totalPoints += points * course.credits;
-                totalCredits += course.credits;
+    /**
+     * Evaluates the transcript under a compile-time GPA policy. Attempts are grouped by course
+     * code and each group is handed to Policy::accumulate, so every institutional rule
+     * compiles to its own loop.
+     */
+    template <class Policy>
+    GPATotals evaluateGPA() const {
+        vector<CourseAttempt> attempts = collectAttempts();
+
+        GPATotals totals;
+        const CourseAttempt* first = attempts.data();
+        const CourseAttempt* end = first + attempts.size();
+        while (first != end) {
+            const CourseAttempt* last = first + 1;
+            while (last != end && last->course->courseCode == first->course->courseCode) {
+                ++last;
             }
+            Policy::accumulate(first, last, totals);
+            first = last;
         }
+        Policy::finish(totals);
+        return totals;
+    }
 
-        if (totalCredits == 0) {
-            return 0.0;
-        }
-        return totalPoints / totalCredits;
+    template <class Policy>
+    double calculateCumulativeGPA() const {
+        TRACE_SCOPE("calculateCumulativeGPA");
+        return evaluateGPA<Policy>().gpa();
     }
 
-    void saveToCSV(const string& filename) const {
-        ofstream file(filename);
-        if (!file.is_open()) return;
+    // Default institutional rule: the latest attempt of a course code wins
+    double calculateCumulativeGPA() const {
+        return calculateCumulativeGPA<LatestAttemptPolicy>();
+    }
 
+    void writeCSV(ostream& file) const {
         file << studentName << "\n";
 
         for (const auto& semester : semesters) {
@@ -173,10 +532,19 @@ public:
                      << course.grade << "\n";
             }
         }
+    }
+
+    void saveToCSV(const string& filename) const {
+        TRACE_SCOPE("saveToCSV");
+        ofstream file(filename);
+        if (!file.is_open()) return;
+
+        writeCSV(file);
         file.close();
     }
 
     void loadFromCSV(const string& filename) {
+        TRACE_SCOPE("loadFromCSV");
         ifstream file(filename);
         if (!file.is_open()) return;
 
@@ -225,138 +593,1395 @@ public:
     }
 };
 
-// SFML UI Components
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
 
 /**
- * @struct Button
- * @brief Simple interactive button structure for SFML.
+ * Parses a pasted block of courses, one per line: code, name, credits, grade. Fields may be
+ * separated by tabs (spreadsheet paste) or commas. Every line is validated; rows with bad
+ * credits, unknown grades or commas inside a tab-separated field are reported in errors and
+ * left out of rows.
  */
-struct Button {
-    sf::RectangleShape rect;
-    sf::Text text;
-    bool isActive = true;
+void parseCourseRows(const string& text, vector<Course>& rows, vector<string>& errors) {
+    rows.clear();
+    errors.clear();
+
+    auto trim = [](string value) {
+        size_t first = value.find_first_not_of(" \t\r");
+        size_t last = value.find_last_not_of(" \t\r");
+        return first == string::npos ? string() : value.substr(first, last - first + 1);
+    };
 
-    Button(const string& label, const sf::Font& font, float x, float y, float w, float h) {
-        rect.setSize({w, h});
-        rect.setPosition(x, y);
-        rect.setFillColor(sf::Color(75, 125, 250));
-        rect.setOutlineThickness(2);
-        rect.setOutlineColor(sf::Color(100, 100, 100));
+    stringstream lines(text);
+    string line;
+    int lineNumber = 0;
+    while (getline(lines, line)) {
+        ++lineNumber;
+        if (trim(line).empty()) continue;
+
+        char separator = line.find('\t') != string::npos ? '\t' : ',';
+        stringstream ss(line);
+        string cCode, cName, sCredits, sGrade;
+        getline(ss, cCode, separator);
+        getline(ss, cName, separator);
+        getline(ss, sCredits, separator);
+        getline(ss, sGrade, separator);
+        cCode = trim(cCode);
+        sCredits = trim(sCredits);
+        sGrade = trim(sGrade);
+
+        string prefix = "Line " + to_string(lineNumber) + ": ";
+        if (cCode.empty()) {
+            errors.push_back(prefix + "missing course code");
+        } else if (cCode.find(',') != string::npos || cName.find(',') != string::npos) {
+            // Transcript CSV fields are unquoted, so a comma would split the row when reloaded
+            errors.push_back(prefix + "commas are not allowed in '" + (cCode.find(',') != string::npos ? cCode : trim(cName)) + "'");
+        } else if (sCredits.empty() || sCredits.size() > 2 || !all_of(sCredits.begin(), sCredits.end(), [](char c) { return isdigit((unsigned char)c); })) {
+            errors.push_back(prefix + "invalid credits '" + sCredits + "'");
+        } else if (gradePointTable().count(sGrade) == 0) {
+            errors.push_back(prefix + "invalid grade '" + sGrade + "'");
+        } else {
+            rows.push_back({cCode, trim(cName), stoi(sCredits), sGrade});
+        }
+    }
+}
 
-        text.setString(label);
-        text.setFont(font);
-        text.setCharacterSize(16);
-        text.setFillColor(sf::Color::White);
+// Transcript History
 
-        centerText();
+/**
+ * @class TranscriptHistory
+ * @brief Append-only log of saved transcript versions, stored as deltas with periodic checkpoints.
+ *
+ * Each version starts with a header line
+ *     VERSION,<number>,<unix time>,<FULL|DELTA>,<op count>,<CSV bytes of this version>
+ * followed by its ops:
+ *     N,<student name>
+ *     +,<semester>,<code>,<occurrence>,<credits>,<grade>,<name>   (course added)
+ *     ~,<semester>,<code>,<occurrence>,<credits>,<grade>,<name>   (course changed)
+ *     -,<semester>,<code>,<occurrence>                            (course removed)
+ * A FULL version is a delta against an empty transcript, so rebuilding any version replays
+ * at most checkpointInterval versions. Courses are keyed by semester, code and occurrence
+ * (for repeats within one semester) and come back in course-code order within a semester.
+ */
+class TranscriptHistory {
+public:
+    explicit TranscriptHistory(const string& historyFile, int interval = 10)
+        : filename(historyFile), checkpointInterval(interval) {
+        scan();
+        if (!versions.empty()) {
+            applyVersions(versions.size() - 1, latestName, latestCourses);
+        }
     }
 
-    void centerText() {
-        sf::FloatRect textBounds = text.getLocalBounds();
-        sf::Vector2f rectPos = rect.getPosition();
-        sf::Vector2f rectSize = rect.getSize();
-        
-        text.setOrigin(textBounds.left + textBounds.width / 2.0f,
-                       textBounds.top + textBounds.height / 2.0f);
-        text.setPosition(rectPos.x + rectSize.x / 2.0f,
-                         rectPos.y + rectSize.y / 2.0f);
-    }
+    // Appends the transcript as a new version; returns its number, or -1 when nothing changed
+    // or savedAt is earlier than the latest version (versionAt relies on sorted timestamps)
+    int record(const Transcript& transcript, time_t savedAt = time(nullptr)) {
+        if (!versions.empty() && savedAt < versions.back().savedAt) {
+            return -1;
+        }
+        CourseState courses = flatten(transcript);
+        vector<string> ops = diff(latestCourses, courses, transcript.studentName != latestName, transcript.studentName);
+        if (!versions.empty() && ops.empty()) {
+            return -1;
+        }
 
-    void draw(sf::RenderWindow& window) const {
-        window.draw(rect);
-        window.draw(text);
-    }
+        // Only a save that changed something is written, as a checkpoint when one is due
+        bool checkpoint = versions.empty() || (int)versions.size() % checkpointInterval == 0;
+        if (checkpoint) {
+            ops = diff(CourseState(), courses, true, transcript.studentName);
+        }
 
-    bool isClicked(int mouseX, int mouseY) const {
-        return isActive && rect.getGlobalBounds().contains((float)mouseX, (float)mouseY);
+        ostringstream csv;
+        transcript.writeCSV(csv);
+
+        error_code ec;
+        uintmax_t offset = filesystem::exists(filename, ec) ? filesystem::file_size(filename, ec) : 0;
+        ofstream file(filename, ios::app);
+        if (!file.is_open()) return -1;
+
+        VersionInfo info{(int)versions.size() + 1, savedAt, checkpoint, (streamoff)offset, (uintmax_t)csv.str().size()};
+        file << "VERSION," << info.number << "," << (long long)info.savedAt << "," << (checkpoint ? "FULL" : "DELTA")
+             << "," << ops.size() << "," << info.csvBytes << "\n";
+        for (const auto& op : ops) {
+            file << op << "\n";
+        }
+        file.close();
+
+        versions.push_back(info);
+        latestName = transcript.studentName;
+        latestCourses = move(courses);
+        return info.number;
     }
 
-    void setHover(bool isHovering) {
-        if (!isActive) return;
-        rect.setFillColor(isHovering ? sf::Color(100, 150, 200) : sf::Color(70, 70, 70));
+    // Rebuilds version number (1-based) by replaying from its nearest checkpoint
+    bool reconstruct(int number, Transcript& out) const {
+        if (number < 1 || number > (int)versions.size()) return false;
+
+        string name;
+        CourseState courses;
+        if (!applyVersions(number - 1, name, courses)) return false;
+
+        out.studentName = name;
+        out.semesters.clear();
+        for (const auto& entry : courses) {
+            const string& semesterID = get<0>(entry.first);
+            if (out.semesters.empty() || out.semesters.back().semesterID != semesterID) {
+                out.semesters.push_back(Semester{semesterID, {}});
+            }
+            out.semesters.back().courses.push_back(entry.second);
+        }
+        return true;
     }
 
-    void setInactive() {
-        isActive = false;
-        rect.setFillColor(sf::Color(50, 50, 50));
-        text.setFillColor(sf::Color(150, 150, 150));
+    // Latest version saved at or before the given time, or -1 if there is none
+    int versionAt(time_t when) const {
+        auto it = upper_bound(versions.begin(), versions.end(), when, [](time_t t, const VersionInfo& info) {
+            return t < info.savedAt;
+        });
+        return it == versions.begin() ? -1 : (it - 1)->number;
     }
-};
 
-/**
- * @struct InputField
- * @brief Simple single-line text input field for SFML.
- */
-struct InputField {
-    sf::RectangleShape rect;
-    sf::Text display;
-    string text = "";
-    string placeholder;
-    bool isFocused = false;
-    bool isNumeric = false;
-    
-    InputField(const sf::Font& font, float x, float y, float w, float h, const string& ph, bool numeric = false) 
-    : placeholder(ph), isNumeric(numeric) {
-        rect.setSize({w, h});
-        rect.setPosition(x, y);
-        rect.setFillColor(sf::Color::White);
-        rect.setOutlineThickness(1);
-        rect.setOutlineColor(sf::Color(150, 150, 150));
+    int versionCount() const { return (int)versions.size(); }
+    time_t savedAt(int number) const { return versions[number - 1].savedAt; }
 
-        display.setFont(font);
-        display.setCharacterSize(14);
-        display.setFillColor(sf::Color::Black);
-        display.setPosition(x + 5, y + 5);
-        updateDisplay();
+    uintmax_t historyBytes() const {
+        error_code ec;
+        uintmax_t size = filesystem::file_size(filename, ec);
+        return ec ? 0 : size;
     }
 
-    void updateDisplay() {
-        if (text.empty() && !isFocused) {
-            display.setString(placeholder);
-            display.setFillColor(sf::Color(180, 180, 180));
-        } else {
-            display.setString(text);
-            display.setFillColor(sf::Color::Black);
+    // What keeping a full dated copy of every version would have cost
+    uintmax_t fullCopyBytes() const {
+        uintmax_t total = 0;
+        for (const auto& info : versions) {
+            total += info.csvBytes;
         }
+        return total;
     }
 
-    void draw(sf::RenderWindow& window) const {
-        window.draw(rect);
-        window.draw(display);
-    }
+private:
+    struct VersionInfo {
+        int number;
+        time_t savedAt;
+        bool checkpoint;
+        streamoff offset;
+        uintmax_t csvBytes;
+    };
+    using CourseKey = tuple<string, string, int>; // Semester, code, occurrence
+    using CourseState = map<CourseKey, Course>;
 
-    bool checkClick(int mouseX, int mouseY) {
-        bool clicked = rect.getGlobalBounds().contains((float)mouseX, (float)mouseY);
-        isFocused = clicked;
-        rect.setOutlineColor(isFocused ? sf::Color(0, 150, 255) : sf::Color(150, 150, 150));
-        updateDisplay();
-        return clicked;
-    }
+    string filename;
+    int checkpointInterval;
+    vector<VersionInfo> versions;
+    string latestName;
+    CourseState latestCourses;
 
-    void processInput(sf::Uint32 unicode) {
-        if (!isFocused) return;
+    void scan() {
+        ifstream file(filename);
+        if (!file.is_open()) return;
 
-        if (unicode == 8) { // Backspace
-            if (!text.empty()) {
-                text.pop_back();
-            }
-        } else if (unicode < 128 && unicode != 13) { // Printable characters, not Enter
-            char c = static_cast<char>(unicode);
-            if (isNumeric) {
-                if (isdigit(c)) {
-                    text += c;
+        string line;
+        streamoff offset = 0;
+        while (getline(file, line)) {
+            if (line.compare(0, 8, "VERSION,") == 0) {
+                stringstream ss(line.substr(8));
+                string number, savedAt, kind, opCount, csvBytes;
+                getline(ss, number, ',');
+                getline(ss, savedAt, ',');
+                getline(ss, kind, ',');
+                getline(ss, opCount, ',');
+                getline(ss, csvBytes, ',');
+                try {
+                    versions.push_back({(int)versions.size() + 1, (time_t)stoll(savedAt), kind == "FULL", offset, stoull(csvBytes)});
+                } catch (const std::exception& e) {
+                    // A torn header ends the usable history
+                    break;
                 }
-            } else {
-                text += c;
             }
+            offset = file.tellg();
         }
-        updateDisplay();
     }
-};
 
-/**
- * @class TranscriptApp
- * @brief Main SFML application logic and state manager.
+    bool applyVersions(size_t lastIndex, string& name, CourseState& courses) const {
+        size_t first = lastIndex;
+        while (first > 0 && !versions[first].checkpoint) {
+            --first;
+        }
+
+        ifstream file(filename);
+        if (!file.is_open()) return false;
+        file.seekg(versions[first].offset);
+
+        size_t index = first;
+        string line;
+        getline(file, line); // Header of the checkpoint
+        while (getline(file, line)) {
+            if (line.compare(0, 8, "VERSION,") == 0) {
+                if (++index > lastIndex) break;
+                continue;
+            }
+            if (line.size() < 2) continue;
+
+            if (line[0] == 'N') {
+                name = line.substr(2);
+                continue;
+            }
+            stringstream ss(line.substr(2));
+            string semesterID, code, occurrence, credits, grade, courseName;
+            getline(ss, semesterID, ',');
+            getline(ss, code, ',');
+            getline(ss, occurrence, ',');
+            try {
+                CourseKey key{semesterID, code, stoi(occurrence)};
+                if (line[0] == '-') {
+                    courses.erase(key);
+                } else {
+                    getline(ss, credits, ',');
+                    getline(ss, grade, ',');
+                    getline(ss, courseName);
+                    courses[key] = Course{code, courseName, stoi(credits), grade};
+                }
+            } catch (const std::exception& e) {
+                // Ignore malformed lines
+            }
+        }
+        return true;
+    }
+
+    static CourseState flatten(const Transcript& transcript) {
+        CourseState courses;
+        for (const auto& semester : transcript.semesters) {
+            map<string, int> occurrences;
+            for (const auto& course : semester.courses) {
+                courses[CourseKey{semester.semesterID, course.courseCode, occurrences[course.courseCode]++}] = course;
+            }
+        }
+        return courses;
+    }
+
+    // Ops turning previous into courses, with the student name first when it is written
+    static vector<string> diff(const CourseState& previous, const CourseState& courses, bool writeName, const string& name) {
+        vector<string> ops;
+        if (writeName) {
+            ops.push_back("N," + name);
+        }
+        for (const auto& entry : courses) {
+            auto it = previous.find(entry.first);
+            if (it == previous.end()) {
+                ops.push_back("+," + encode(entry.first, &entry.second));
+            } else if (!sameCourse(it->second, entry.second)) {
+                ops.push_back("~," + encode(entry.first, &entry.second));
+            }
+        }
+        for (const auto& entry : previous) {
+            if (courses.find(entry.first) == courses.end()) {
+                ops.push_back("-," + encode(entry.first, nullptr));
+            }
+        }
+        return ops;
+    }
+
+    static string encode(const CourseKey& key, const Course* course) {
+        string text = get<0>(key) + "," + get<1>(key) + "," + to_string(get<2>(key));
+        if (course) {
+            text += "," + to_string(course->credits) + "," + course->grade + "," + course->courseName;
+        }
+        return text;
+    }
+
+    static bool sameCourse(const Course& a, const Course& b) {
+        return a.courseName == b.courseName && a.credits == b.credits && a.grade == b.grade;
+    }
+};
+
+// Degree Audit
+
+/**
+ * @class CourseCatalog
+ * @brief Assigns dense IDs to course codes and their prefixes (e.g. "CSC") for bitset audits.
+ */
+class CourseCatalog {
+public:
+    int addCourse(const string& courseCode) {
+        auto it = courseIds.find(courseCode);
+        if (it != courseIds.end()) {
+            return it->second;
+        }
+        int id = (int)courseCodes.size();
+        courseIds[courseCode] = id;
+        courseCodes.push_back(courseCode);
+        coursePrefixes.push_back(addPrefix(prefixOf(courseCode)));
+        return id;
+    }
+
+    void addTranscript(const Transcript& transcript) {
+        for (const auto& semester : transcript.semesters) {
+            for (const auto& course : semester.courses) {
+                addCourse(course.courseCode);
+            }
+        }
+    }
+
+    int addPrefix(const string& prefix) {
+        auto it = prefixIds.find(prefix);
+        if (it != prefixIds.end()) {
+            return it->second;
+        }
+        int id = (int)prefixes.size();
+        prefixIds[prefix] = id;
+        prefixes.push_back(prefix);
+        return id;
+    }
+
+    // Returns -1 for codes the catalog has never seen
+    int findCourse(const string& courseCode) const {
+        auto it = courseIds.find(courseCode);
+        return it == courseIds.end() ? -1 : it->second;
+    }
+
+    const string& courseCode(int id) const { return courseCodes[id]; }
+    int prefixOfCourse(int id) const { return coursePrefixes[id]; }
+    const string& prefix(int id) const { return prefixes[id]; }
+    size_t courseCount() const { return courseCodes.size(); }
+    size_t prefixCount() const { return prefixes.size(); }
+    size_t wordCount() const { return (courseCodes.size() + 63) / 64; }
+
+    // "CSC 319" -> "CSC"
+    static string prefixOf(const string& courseCode) {
+        size_t end = 0;
+        while (end < courseCode.size() && isalpha((unsigned char)courseCode[end])) {
+            ++end;
+        }
+        return courseCode.substr(0, end);
+    }
+
+private:
+    unordered_map<string, int> courseIds;
+    vector<string> courseCodes;
+    vector<int> coursePrefixes;
+    unordered_map<string, int> prefixIds;
+    vector<string> prefixes;
+};
+
+/**
+ * @struct DegreeRequirements
+ * @brief Degree rules loaded from a CSV rule file, one rule per line:
+ *        NAME,<program name>
+ *        MIN_GRADE,<grade>             default minimum for REQUIRE lines without one
+ *        REQUIRE,<course code>[,<grade>]
+ *        CREDITS,<prefix>,<minimum passed credits>
+ *        Blank lines and lines starting with '#' are ignored.
+ */
+struct DegreeRequirements {
+    struct RequiredCourse {
+        string courseCode;
+        string minGrade; // Empty means any passing grade, including P
+    };
+    struct CreditMinimum {
+        string prefix;
+        int credits;
+    };
+
+    string programName = "Degree Requirements";
+    vector<RequiredCourse> requiredCourses;
+    vector<CreditMinimum> creditMinimums;
+
+    static double minPointsOf(const string& minGrade) {
+        return minGrade.empty() ? 0.0 : gradePointTable().at(minGrade);
+    }
+
+    bool loadFromCSV(const string& filename) {
+        ifstream file(filename);
+        if (!file.is_open()) return false;
+
+        requiredCourses.clear();
+        creditMinimums.clear();
+        string defaultMinGrade;
+
+        string line;
+        while (getline(file, line)) {
+            if (line.empty() || line[0] == '#') continue;
+
+            stringstream ss(line);
+            string rule, first, second;
+            getline(ss, rule, ',');
+            getline(ss, first, ',');
+            getline(ss, second, ',');
+
+            try {
+                if (rule == "NAME") {
+                    programName = first;
+                } else if (rule == "MIN_GRADE" && isMinimumGrade(first)) {
+                    defaultMinGrade = first;
+                } else if (rule == "REQUIRE" && !first.empty()) {
+                    string minGrade = isMinimumGrade(second) ? second
+                                    : gradePointTable().count(second) ? "" : defaultMinGrade;
+                    // A repeat at the same grade level (e.g. A and A+) is the same requirement
+                    bool duplicate = any_of(requiredCourses.begin(), requiredCourses.end(), [&](const RequiredCourse& existing) {
+                        return existing.courseCode == first && minPointsOf(existing.minGrade) == minPointsOf(minGrade);
+                    });
+                    if (!duplicate) {
+                        requiredCourses.push_back({first, minGrade});
+                    }
+                } else if (rule == "CREDITS" && !first.empty()) {
+                    creditMinimums.push_back({first, stoi(second)});
+                }
+            } catch (const std::exception& e) {
+                // Ignore malformed lines
+            }
+        }
+        return true;
+    }
+
+    // Only passing letter grades (D- and up) make sense as a minimum; F/W/P mean "any pass"
+    static bool isMinimumGrade(const string& grade) {
+        auto it = gradePointTable().find(grade);
+        return it != gradePointTable().end() && it->second > 0;
+    }
+};
+
+/**
+ * @struct AuditResult
+ * @brief Outcome of auditing one transcript: unmet course IDs and passed credits per rule.
+ */
+struct AuditResult {
+    vector<int> missingCourses;  // Indexes into DegreeRequirements::requiredCourses
+    vector<int> creditsEarned;   // Parallel to DegreeRequirements::creditMinimums
+    bool satisfied = false;
+};
+
+/**
+ * @class CompiledAudit
+ * @brief Degree requirements compiled into per-grade-level course bitmasks over catalog IDs.
+ *
+ * Level 0 is "any passing grade" (points > 0 or P); every other level is a minimum grade.
+ * A transcript is reduced to one "has" bitset per level, so checking all required courses
+ * is a handful of AND-NOT operations per 64 catalog courses. Intern the cohort's courses into
+ * the catalog before auditing; audit() itself only reads the catalog and is thread-safe.
+ */
+class CompiledAudit {
+public:
+    CompiledAudit(const DegreeRequirements& req, CourseCatalog& catalog) : requirements(req) {
+        for (const auto& required : req.requiredCourses) {
+            catalog.addCourse(required.courseCode);
+        }
+        for (const auto& minimum : req.creditMinimums) {
+            creditPrefixes.push_back(catalog.addPrefix(minimum.prefix));
+        }
+
+        levelMinPoints.push_back(0.0);
+        for (const auto& required : req.requiredCourses) {
+            double minPoints = DegreeRequirements::minPointsOf(required.minGrade);
+            if (find(levelMinPoints.begin(), levelMinPoints.end(), minPoints) == levelMinPoints.end()) {
+                levelMinPoints.push_back(minPoints);
+            }
+        }
+        sort(levelMinPoints.begin() + 1, levelMinPoints.end());
+
+        words = catalog.wordCount();
+        requiredMasks.assign(levelMinPoints.size() * words, 0);
+        requirementSlots.assign(levelMinPoints.size() * words * 64, -1);
+        for (size_t i = 0; i < req.requiredCourses.size(); ++i) {
+            size_t slot = levelOf(req.requiredCourses[i].minGrade) * words * 64 + catalog.findCourse(req.requiredCourses[i].courseCode);
+            requiredMasks[slot / 64] |= uint64_t(1) << (slot % 64);
+            requirementSlots[slot] = (int)i;
+        }
+    }
+
+    // Courses added to the catalog after compiling are never required, so they only need
+    // "has" bits for de-duplicating repeats; the required masks cover the original words.
+    AuditResult audit(const Transcript& transcript, const CourseCatalog& catalog) const {
+        const size_t levels = levelMinPoints.size();
+        const size_t hasWords = max(words, catalog.wordCount());
+        vector<uint64_t> has(levels * hasWords, 0);
+        vector<int> prefixCredits(catalog.prefixCount(), 0);
+
+        for (const auto& semester : transcript.semesters) {
+            for (const auto& course : semester.courses) {
+                int id = catalog.findCourse(course.courseCode);
+                if (id < 0) continue;
+
+                double points = course.getGradePoints();
+                bool passed = points > 0 || course.grade == "P";
+                size_t word = id / 64;
+                uint64_t bit = uint64_t(1) << (id % 64);
+
+                // Repeats only earn credit once, on the first passing attempt
+                int newlyPassed = passed && !(has[word] & bit);
+                prefixCredits[catalog.prefixOfCourse(id)] += newlyPassed * course.credits;
+                has[word] |= passed ? bit : 0;
+                for (size_t level = 1; level < levels; ++level) {
+                    has[level * hasWords + word] |= points >= levelMinPoints[level] ? bit : 0;
+                }
+            }
+        }
+
+        AuditResult result;
+        for (size_t level = 0; level < levels; ++level) {
+            for (size_t word = 0; word < words; ++word) {
+                uint64_t missing = requiredMasks[level * words + word] & ~has[level * hasWords + word];
+                while (missing) {
+                    size_t slot = (level * words + word) * 64 + __builtin_ctzll(missing);
+                    result.missingCourses.push_back(requirementSlots[slot]);
+                    missing &= missing - 1;
+                }
+            }
+        }
+        sort(result.missingCourses.begin(), result.missingCourses.end());
+
+        bool creditsMet = true;
+        for (size_t i = 0; i < creditPrefixes.size(); ++i) {
+            result.creditsEarned.push_back(prefixCredits[creditPrefixes[i]]);
+            creditsMet = creditsMet && result.creditsEarned.back() >= requirements.creditMinimums[i].credits;
+        }
+        result.satisfied = result.missingCourses.empty() && creditsMet;
+        return result;
+    }
+
+    const DegreeRequirements& getRequirements() const { return requirements; }
+
+private:
+    DegreeRequirements requirements;
+    vector<double> levelMinPoints;
+    vector<int> creditPrefixes;
+    vector<uint64_t> requiredMasks; // levels x words
+    vector<int> requirementSlots;   // Bit position -> index into requiredCourses
+    size_t words = 0;
+
+    size_t levelOf(const string& minGrade) const {
+        double minPoints = DegreeRequirements::minPointsOf(minGrade);
+        return find(levelMinPoints.begin(), levelMinPoints.end(), minPoints) - levelMinPoints.begin();
+    }
+};
+
+/**
+ * Audits a whole cohort, splitting transcripts across all hardware threads.
+ */
+vector<AuditResult> auditCohort(const CompiledAudit& audit, const CourseCatalog& catalog, const vector<Transcript>& cohort) {
+    vector<AuditResult> results(cohort.size());
+    atomic<size_t> nextChunk(0);
+    const size_t chunkSize = 256;
+
+    auto worker = [&]() {
+        for (;;) {
+            size_t begin = nextChunk.fetch_add(chunkSize);
+            if (begin >= cohort.size()) return;
+            size_t end = min(begin + chunkSize, cohort.size());
+            for (size_t i = begin; i < end; ++i) {
+                results[i] = audit.audit(cohort[i], catalog);
+            }
+        }
+    };
+
+    unsigned threadCount = max(1u, thread::hardware_concurrency());
+    vector<thread> threads;
+    for (unsigned t = 1; t < threadCount; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : threads) {
+        t.join();
+    }
+    return results;
+}
+
+/**
+ * @struct AuditLine
+ * @brief One human-readable requirement line for the audit view and CLI.
+ */
+struct AuditLine {
+    string text;
+    bool met;
+};
+
+// Unmet requirements are listed first
+vector<AuditLine> describeAudit(const DegreeRequirements& requirements, const AuditResult& result) {
+    vector<AuditLine> lines;
+    vector<bool> missing(requirements.requiredCourses.size(), false);
+    for (int index : result.missingCourses) {
+        missing[index] = true;
+    }
+
+    for (size_t i = 0; i < requirements.requiredCourses.size(); ++i) {
+        const auto& required = requirements.requiredCourses[i];
+        string text = required.courseCode + (required.minGrade.empty() ? "" : " (min " + required.minGrade + ")");
+        lines.push_back({text, !missing[i]});
+    }
+    for (size_t i = 0; i < requirements.creditMinimums.size(); ++i) {
+        const auto& minimum = requirements.creditMinimums[i];
+        lines.push_back({minimum.prefix + " credits: " + to_string(result.creditsEarned[i]) + " / " + to_string(minimum.credits),
+                         result.creditsEarned[i] >= minimum.credits});
+    }
+
+    stable_partition(lines.begin(), lines.end(), [](const AuditLine& line) { return !line.met; });
+    return lines;
+}
+
+// Cohort GPA Kernel
+
+// Same contraction rule as the member functions; exactness depends on it
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+/**
+ * @struct CohortColumns
+ * @brief Structure-of-arrays view of a whole cohort for batch GPA computation.
+ *
+ * Records are stored in transcript/semester/course order. Semester GPAs are segments of that
+ * order; cumulative GPAs are segments of cumulativeIndex, which lists each student's
+ * latest attempts in course-code order, exactly the summation order of calculateCumulativeGPA.
+ */
+struct CohortColumns {
+    vector<double> points;               // Grade points per record, -1.0 for W/P
+    vector<double> credits;              // Credits per record
+    vector<uint32_t> semesterOffsets;    // Semester s covers records [semesterOffsets[s], semesterOffsets[s + 1])
+    vector<uint32_t> cumulativeIndex;    // Record indexes counted toward cumulative GPAs
+    vector<uint32_t> studentOffsets;     // Student t covers cumulativeIndex [studentOffsets[t], studentOffsets[t + 1])
+    vector<uint32_t> studentSemesters;   // Student t owns semesters [studentSemesters[t], studentSemesters[t + 1])
+
+    void build(const vector<Transcript>& cohort) {
+        points.clear();
+        credits.clear();
+        cumulativeIndex.clear();
+        semesterOffsets.assign(1, 0);
+        studentOffsets.assign(1, 0);
+        studentSemesters.assign(1, 0);
+
+        for (const auto& transcript : cohort) {
+            uint32_t firstRecord = (uint32_t)points.size();
+            for (const auto& semester : transcript.semesters) {
+                for (const auto& course : semester.courses) {
+                    points.push_back(course.getGradePoints());
+                    credits.push_back(course.credits);
+                }
+                semesterOffsets.push_back((uint32_t)points.size());
+            }
+            studentSemesters.push_back((uint32_t)semesterOffsets.size() - 1);
+
+            vector<CourseAttempt> attempts = transcript.collectAttempts();
+            const CourseAttempt* first = attempts.data();
+            const CourseAttempt* end = first + attempts.size();
+            while (first != end) {
+                const CourseAttempt* last = first + 1;
+                while (last != end && last->course->courseCode == first->course->courseCode) {
+                    ++last;
+                }
+                cumulativeIndex.push_back(firstRecord + LatestAttemptPolicy::select(first, last)->sequence);
+                first = last;
+            }
+            studentOffsets.push_back((uint32_t)cumulativeIndex.size());
+        }
+    }
+
+    size_t recordCount() const { return points.size(); }
+    size_t semesterCount() const { return semesterOffsets.size() - 1; }
+    size_t studentCount() const { return studentOffsets.size() - 1; }
+};
+
+enum class GPAKernel { Scalar, SSE2, AVX2 };
+
+/**
+ * Segmented GPA over the columns: segment i covers [offsets[i], offsets[i + 1]) of either the
+ * records themselves (index == nullptr) or of index. Every segment is summed strictly in
+ * order with a separate multiply and add, so results are bit-identical to the Semester and
+ * Transcript member functions.
+ */
+void segmentedGPAScalar(const double* points, const double* credits, const uint32_t* index,
+                        const uint32_t* offsets, size_t first, size_t last, double* out) {
+    for (size_t seg = first; seg < last; ++seg) {
+        double totalPoints = 0.0;
+        double totalCredits = 0.0;
+        for (uint32_t k = offsets[seg]; k < offsets[seg + 1]; ++k) {
+            uint32_t r = index ? index[k] : k;
+            if (points[r] >= 0) {
+                totalPoints += points[r] * credits[r];
+                totalCredits += credits[r];
+            }
+        }
+        out[seg] = totalCredits == 0 ? 0.0 : totalPoints / totalCredits;
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// Two segments per step, one per SSE2 lane; inactive and W/P lanes add zero
+void segmentedGPASSE2(const double* points, const double* credits, const uint32_t* index,
+                      const uint32_t* offsets, size_t segments, double* out) {
+    size_t seg = 0;
+    for (; seg + 2 <= segments; seg += 2) {
+        uint32_t begin[2] = {offsets[seg], offsets[seg + 1]};
+        uint32_t length[2] = {offsets[seg + 1] - begin[0], offsets[seg + 2] - begin[1]};
+        uint32_t steps = max(length[0], length[1]);
+
+        __m128d totalPoints = _mm_setzero_pd();
+        __m128d totalCredits = _mm_setzero_pd();
+        for (uint32_t k = 0; k < steps; ++k) {
+            // Finished lanes re-read their last record and empty lanes read record 0, which exists
+            // because the other lane is non-empty; both are masked off below
+            uint32_t r0 = length[0] ? begin[0] + min(k, length[0] - 1) : 0;
+            uint32_t r1 = length[1] ? begin[1] + min(k, length[1] - 1) : 0;
+            if (index) {
+                r0 = length[0] ? index[r0] : 0;
+                r1 = length[1] ? index[r1] : 0;
+            }
+            __m128d active = _mm_castsi128_pd(_mm_set_epi64x(-(int64_t)(k < length[1]), -(int64_t)(k < length[0])));
+            __m128d vp = _mm_and_pd(_mm_set_pd(points[r1], points[r0]), active);
+            __m128d vc = _mm_and_pd(_mm_set_pd(credits[r1], credits[r0]), _mm_and_pd(active, _mm_cmpge_pd(vp, _mm_setzero_pd())));
+            totalPoints = _mm_add_pd(totalPoints, _mm_mul_pd(vp, vc));
+            totalCredits = _mm_add_pd(totalCredits, vc);
+        }
+
+        __m128d empty = _mm_cmpeq_pd(totalCredits, _mm_setzero_pd());
+        __m128d gpa = _mm_div_pd(totalPoints, totalCredits);
+        _mm_storeu_pd(out + seg, _mm_andnot_pd(empty, gpa));
+    }
+    segmentedGPAScalar(points, credits, index, offsets, seg, segments, out);
+}
+
+// Four segments per step, one per AVX2 lane, with masked gathers for the column loads
+__attribute__((target("avx2")))
+void segmentedGPAAVX2(const double* points, const double* credits, const uint32_t* index,
+                      const uint32_t* offsets, size_t segments, double* out) {
+    const __m256d zero = _mm256_setzero_pd();
+    size_t seg = 0;
+    for (; seg + 4 <= segments; seg += 4) {
+        __m128i begin = _mm_loadu_si128((const __m128i*)(offsets + seg));
+        __m128i end = _mm_loadu_si128((const __m128i*)(offsets + seg + 1));
+        __m128i length = _mm_sub_epi32(end, begin);
+        uint32_t lengths[4];
+        _mm_storeu_si128((__m128i*)lengths, length);
+        uint32_t steps = max(max(lengths[0], lengths[1]), max(lengths[2], lengths[3]));
+
+        __m256d totalPoints = zero;
+        __m256d totalCredits = zero;
+        for (uint32_t k = 0; k < steps; ++k) {
+            __m128i step = _mm_set1_epi32((int)k);
+            __m128i active = _mm_cmpgt_epi32(length, step); // Lengths fit in int32
+            __m128i position = _mm_add_epi32(begin, step);
+            __m128i record = index
+                ? _mm_mask_i32gather_epi32(_mm_setzero_si128(), (const int*)index, position, active, 4)
+                : position;
+            __m256d laneMask = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(active));
+
+            __m256d vp = _mm256_mask_i32gather_pd(zero, points, record, laneMask, 8);
+            __m256d vc = _mm256_mask_i32gather_pd(zero, credits, record, laneMask, 8);
+            vc = _mm256_and_pd(vc, _mm256_cmp_pd(vp, zero, _CMP_GE_OQ));
+            totalPoints = _mm256_add_pd(totalPoints, _mm256_mul_pd(vp, vc));
+            totalCredits = _mm256_add_pd(totalCredits, vc);
+        }
+
+        __m256d empty = _mm256_cmp_pd(totalCredits, zero, _CMP_EQ_OQ);
+        __m256d gpa = _mm256_div_pd(totalPoints, totalCredits);
+        _mm256_storeu_pd(out + seg, _mm256_andnot_pd(empty, gpa));
+    }
+    segmentedGPAScalar(points, credits, index, offsets, seg, segments, out);
+}
+#endif
+
+GPAKernel bestGPAKernel() {
+#if defined(__x86_64__) || defined(__i386__)
+    if (__builtin_cpu_supports("avx2")) return GPAKernel::AVX2;
+    return GPAKernel::SSE2;
+#else
+    return GPAKernel::Scalar;
+#endif
+}
+
+/**
+ * Computes every semester GPA and every cumulative GPA of the cohort in one call.
+ */
+void computeCohortGPAs(const CohortColumns& columns, vector<double>& semesterGPAs, vector<double>& cumulativeGPAs,
+                       GPAKernel kernel = bestGPAKernel()) {
+    semesterGPAs.resize(columns.semesterCount());
+    cumulativeGPAs.resize(columns.studentCount());
+
+    auto run = [&](const uint32_t* index, const vector<uint32_t>& offsets, double* out) {
+        size_t segments = offsets.size() - 1;
+        switch (kernel) {
+#if defined(__x86_64__) || defined(__i386__)
+            case GPAKernel::AVX2:
+                segmentedGPAAVX2(columns.points.data(), columns.credits.data(), index, offsets.data(), segments, out);
+                return;
+            case GPAKernel::SSE2:
+                segmentedGPASSE2(columns.points.data(), columns.credits.data(), index, offsets.data(), segments, out);
+                return;
+#endif
+            default:
+                segmentedGPAScalar(columns.points.data(), columns.credits.data(), index, offsets.data(), 0, segments, out);
+                return;
+        }
+    };
+    run(nullptr, columns.semesterOffsets, semesterGPAs.data());
+    run(columns.cumulativeIndex.data(), columns.studentOffsets, cumulativeGPAs.data());
+}
+
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+// Cohort Ranking
+
+/**
+ * @class GPARankIndex
+ * @brief Fenwick tree of cohort GPAs quantized to 0.001, giving O(log n) updates and
+ *        O(log n) rank/percentile queries.
+ */
+class GPARankIndex {
+public:
+    GPARankIndex() : tree(BUCKETS + 1, 0) {}
+
+    void insert(double gpa) {
+        add(bucketOf(gpa), 1);
+        ++count;
+    }
+
+    void erase(double gpa) {
+        add(bucketOf(gpa), -1);
+        --count;
+    }
+
+    // Moves one student's entry when their transcript changes
+    void update(double oldGPA, double newGPA) {
+        add(bucketOf(oldGPA), -1);
+        add(bucketOf(newGPA), 1);
+    }
+
+    size_t size() const { return count; }
+
+    size_t countBelow(double gpa) const {
+        return prefixSum(bucketOf(gpa) - 1);
+    }
+
+    size_t countAtOrBelow(double gpa) const {
+        return prefixSum(bucketOf(gpa));
+    }
+
+    // 1 is the highest GPA; students with equal GPAs share a rank
+    size_t rank(double gpa) const {
+        return count - countAtOrBelow(gpa) + 1;
+    }
+
+    // Percentile rank: share of the cohort below this GPA, counting ties as half
+    double percentile(double gpa) const {
+        if (count == 0) return 0.0;
+        size_t below = countBelow(gpa);
+        size_t equal = countAtOrBelow(gpa) - below;
+        return 100.0 * (below + 0.5 * equal) / count;
+    }
+
+private:
+    static const int BUCKETS = 4001; // 0.000 .. 4.000
+    vector<int> tree;                // 1-based Fenwick array over buckets
+    size_t count = 0;
+
+    static int bucketOf(double gpa) {
+        return min(BUCKETS - 1, max(0, (int)lround(gpa * 1000.0)));
+    }
+
+    void add(int bucket, int delta) {
+        for (int i = bucket + 1; i <= BUCKETS; i += i & -i) {
+            tree[i] += delta;
+        }
+    }
+
+    size_t prefixSum(int bucket) const {
+        long long sum = 0;
+        for (int i = bucket + 1; i > 0; i -= i & -i) {
+            sum += tree[i];
+        }
+        return (size_t)sum;
+    }
+};
+
+// Input Recording
+
+/**
+ * Heap allocations are counted per thread, and only while a replay has counting switched on,
+ * so other modes pay one relaxed load per allocation and threads never share a counter.
+ */
+atomic<bool> allocationCountingEnabled(false);
+thread_local uint64_t threadAllocations = 0;
+
+void setAllocationCounting(bool enabled) {
+    allocationCountingEnabled.store(enabled, memory_order_relaxed);
+}
+
+// Allocations made by the calling thread while counting was on
+uint64_t allocationCount() {
+    return threadAllocations;
+}
+
+void* operator new(size_t size) {
+    if (allocationCountingEnabled.load(memory_order_relaxed)) {
+        ++threadAllocations;
+    }
+    if (void* ptr = malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw bad_alloc();
+}
+
+// The other forms are replaced too, so every allocation and release in the process is the same
+// malloc/free pair even when a library (or a sanitizer) supplies its own default forms
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    try {
+        return ::operator new(size);
+    } catch (const bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new[](size_t size, const nothrow_t& tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+// Kept out of line so GCC does not see free() inlined against a builtin operator new and warn
+// of a mismatch
+__attribute__((noinline)) void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, const nothrow_t&) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    ::operator delete(ptr);
+}
+
+void operator delete[](void* ptr, const nothrow_t&) noexcept {
+    ::operator delete(ptr);
+}
+
+/**
+ * @struct RecordedEvent
+ * @brief One line of a recording: the frame it was handled in, microseconds since recording
+ *        started, and either an sf::Event or captured clipboard text.
+ *
+ * Line format: <frame> <time us> <type> <fields...>
+ *   Closed | Text <unicode> | Key <code> <alt> <control> <shift> <system>
+ *   Click <button> <x> <y> | Release <button> <x> <y> | Move <x> <y>
+ *   Wheel <wheel> <delta> <x> <y> | Clipboard <hex-encoded UTF-8>
+ */
+struct RecordedEvent {
+    uint64_t frame = 0;
+    uint64_t timeMicros = 0;
+    sf::Event event;
+    bool hasClipboard = false;
+    string clipboard;
+};
+
+string serializeEvent(const sf::Event& event) {
+    ostringstream out;
+    switch (event.type) {
+        case sf::Event::Closed:
+            out << "Closed";
+            break;
+        case sf::Event::TextEntered:
+            out << "Text " << event.text.unicode;
+            break;
+        case sf::Event::KeyPressed:
+            out << "Key " << (int)event.key.code << " " << event.key.alt << " " << event.key.control << " "
+                << event.key.shift << " " << event.key.system;
+            break;
+        case sf::Event::MouseButtonPressed:
+        case sf::Event::MouseButtonReleased:
+            out << (event.type == sf::Event::MouseButtonPressed ? "Click " : "Release ")
+                << (int)event.mouseButton.button << " " << event.mouseButton.x << " " << event.mouseButton.y;
+            break;
+        case sf::Event::MouseMoved:
+            out << "Move " << event.mouseMove.x << " " << event.mouseMove.y;
+            break;
+        case sf::Event::MouseWheelScrolled:
+            out << "Wheel " << (int)event.mouseWheelScroll.wheel << " " << event.mouseWheelScroll.delta << " "
+                << event.mouseWheelScroll.x << " " << event.mouseWheelScroll.y;
+            break;
+        default:
+            out << "Other " << (int)event.type;
+            break;
+    }
+    return out.str();
+}
+
+string serializeClipboard(const string& text) {
+    static const char* digits = "0123456789abcdef";
+    string hex = "Clipboard ";
+    for (unsigned char c : text) {
+        hex += digits[c >> 4];
+        hex += digits[c & 15];
+    }
+    return hex;
+}
+
+bool loadRecording(const string& filename, vector<RecordedEvent>& recording) {
+    ifstream file(filename);
+    if (!file.is_open()) return false;
+
+    string line;
+    while (getline(file, line)) {
+        istringstream in(line);
+        RecordedEvent recorded;
+        string type;
+        if (!(in >> recorded.frame >> recorded.timeMicros >> type)) continue;
+
+        sf::Event& event = recorded.event;
+        int a = 0, b = 0, c = 0, d = 0, e = 0;
+        if (type == "Closed") {
+            event.type = sf::Event::Closed;
+        } else if (type == "Text" && in >> event.text.unicode) {
+            event.type = sf::Event::TextEntered;
+        } else if (type == "Key" && in >> a >> b >> c >> d >> e) {
+            event.type = sf::Event::KeyPressed;
+            event.key.code = (sf::Keyboard::Key)a;
+            event.key.alt = b;
+            event.key.control = c;
+            event.key.shift = d;
+            event.key.system = e;
+        } else if ((type == "Click" || type == "Release") && in >> a >> b >> c) {
+            event.type = type == "Click" ? sf::Event::MouseButtonPressed : sf::Event::MouseButtonReleased;
+            event.mouseButton.button = (sf::Mouse::Button)a;
+            event.mouseButton.x = b;
+            event.mouseButton.y = c;
+        } else if (type == "Move" && in >> a >> b) {
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = a;
+            event.mouseMove.y = b;
+        } else if (type == "Wheel" && in >> a >> event.mouseWheelScroll.delta >> b >> c) {
+            event.type = sf::Event::MouseWheelScrolled;
+            event.mouseWheelScroll.wheel = (sf::Mouse::Wheel)a;
+            event.mouseWheelScroll.x = b;
+            event.mouseWheelScroll.y = c;
+        } else if (type == "Clipboard") {
+            string hex;
+            in >> hex;
+            recorded.hasClipboard = true;
+            for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+                recorded.clipboard += (char)stoi(hex.substr(i, 2), nullptr, 16);
+            }
+        } else {
+            continue; // Events the app ignores are not replayed
+        }
+        recording.push_back(recorded);
+    }
+    return true;
+}
+
+// SFML UI Components
+
+/**
+ * @struct Button
+ * @brief Simple interactive button structure for SFML.
+ */
+struct Button {
+    sf::RectangleShape rect;
+    sf::Text text;
+    bool isActive = true;
+
+    Button(const string& label, const sf::Font& font, float x, float y, float w, float h) {
+        rect.setSize({w, h});
+        rect.setPosition(x, y);
+        rect.setFillColor(sf::Color(75, 125, 250));
+        rect.setOutlineThickness(2);
+        rect.setOutlineColor(sf::Color(100, 100, 100));
+
+        text.setString(label);
+        text.setFont(font);
+        text.setCharacterSize(16);
+        text.setFillColor(sf::Color::White);
+    }
+
+    // Measuring text loads glyphs, so centering happens at draw time on the render thread
+    void centerText(sf::Text& label) const {
+        sf::FloatRect textBounds = label.getLocalBounds();
+        sf::Vector2f rectPos = rect.getPosition();
+        sf::Vector2f rectSize = rect.getSize();
+        
+        label.setOrigin(textBounds.left + textBounds.width / 2.0f,
+                        textBounds.top + textBounds.height / 2.0f);
+        label.setPosition(rectPos.x + rectSize.x / 2.0f,
+                          rectPos.y + rectSize.y / 2.0f);
+    }
+
+    void draw(sf::RenderTarget& window) const {
+        sf::Text label = text;
+        centerText(label);
+        window.draw(rect);
+        window.draw(label);
+    }
+
+    bool isClicked(int mouseX, int mouseY) const {
+        return isActive && rect.getGlobalBounds().contains((float)mouseX, (float)mouseY);
+    }
+
+    void setHover(bool isHovering) {
+        if (!isActive) return;
+        rect.setFillColor(isHovering ? sf::Color(100, 150, 200) : sf::Color(70, 70, 70));
+    }
+
+    void setInactive() {
+        isActive = false;
+        rect.setFillColor(sf::Color(50, 50, 50));
+        text.setFillColor(sf::Color(150, 150, 150));
+    }
+};
+
+/**
+ * @struct InputField
+ * @brief Simple single-line text input field for SFML.
+ */
+struct InputField {
+    sf::RectangleShape rect;
+    sf::Text display;
+    string text = "";
+    string placeholder;
+    bool isFocused = false;
+    bool isNumeric = false;
+    
+    InputField(const sf::Font& font, float x, float y, float w, float h, const string& ph, bool numeric = false) 
+    : placeholder(ph), isNumeric(numeric) {
+        rect.setSize({w, h});
+        rect.setPosition(x, y);
+        rect.setFillColor(sf::Color::White);
+        rect.setOutlineThickness(1);
+        rect.setOutlineColor(sf::Color(150, 150, 150));
+
+        display.setFont(font);
+        display.setCharacterSize(14);
+        display.setFillColor(sf::Color::Black);
+        display.setPosition(x + 5, y + 5);
+        updateDisplay();
+    }
+
+    void updateDisplay() {
+        if (text.empty() && !isFocused) {
+            display.setString(placeholder);
+            display.setFillColor(sf::Color(180, 180, 180));
+        } else {
+            display.setString(text);
+            display.setFillColor(sf::Color::Black);
+        }
+    }
+
+    void draw(sf::RenderTarget& window) const {
+        window.draw(rect);
+        window.draw(display);
+    }
+
+    bool checkClick(int mouseX, int mouseY) {
+        bool clicked = rect.getGlobalBounds().contains((float)mouseX, (float)mouseY);
+        isFocused = clicked;
+        rect.setOutlineColor(isFocused ? sf::Color(0, 150, 255) : sf::Color(150, 150, 150));
+        updateDisplay();
+        return clicked;
+    }
+
+    void processInput(sf::Uint32 unicode) {
+        if (!isFocused) return;
+
+        if (unicode == 8) { // Backspace
+            if (!text.empty()) {
+                text.pop_back();
+            }
+        } else if (unicode < 128 && unicode != 13) { // Printable characters, not Enter
+            char c = static_cast<char>(unicode);
+            if (isNumeric) {
+                if (isdigit(c)) {
+                    text += c;
+                }
+            } else {
+                text += c;
+            }
+        }
+        updateDisplay();
+    }
+};
+
+/**
+ * @struct SummaryLine
+ * @brief One laid-out line of the transcript summary (semester header, table row or GPA).
+ */
+struct SummaryLine {
+    enum Kind { SEMESTER_HEADER, COLUMN_HEADER, COURSE_ROW, SEMESTER_GPA };
+    Kind kind;
+    string cells[4];
+    float height;
+};
+
+/**
+ * @struct DrawCommand
+ * @brief One recorded drawing operation of a frame snapshot.
+ */
+struct DrawCommand {
+    enum Kind { TEXT, RECT, SCROLL_VIEW, DEFAULT_VIEW };
+    Kind kind;
+    string text;          // UTF-8, for TEXT
+    float x, y;           // Position; SCROLL_VIEW keeps the scroll offset in y
+    float width, height;  // For RECT
+    unsigned size;        // Character size, for TEXT
+    sf::Color color;
+};
+
+/**
+ * @struct FrameSnapshot
+ * @brief Everything needed to draw one frame, built by the logic thread from the model.
+ *        Drawing it needs only the font, never the Transcript.
+ */
+struct FrameSnapshot {
+    sf::Color background = sf::Color(175, 150, 150);
+    vector<DrawCommand> commands;
+    vector<Button> buttons;
+    vector<InputField> inputs;
+
+    void reset(const sf::Color& color) {
+        background = color;
+        commands.clear(); // Keeps capacity, so steady-state frames do not reallocate
+        buttons.clear();
+        inputs.clear();
+    }
+
+    void addText(const string& str, float x, float y, unsigned int size, const sf::Color& color) {
+        commands.push_back({DrawCommand::TEXT, str, x, y, 0, 0, size, color});
+    }
+
+    void addRect(float x, float y, float width, float height, const sf::Color& color) {
+        commands.push_back({DrawCommand::RECT, "", x, y, width, height, 0, color});
+    }
+
+    void addView(DrawCommand::Kind kind, float scrollOffset = 0.0f) {
+        commands.push_back({kind, "", 0, scrollOffset, 0, 0, 0, sf::Color::White});
+    }
+};
+
+/**
+ * @class FrameExchange
+ * @brief Lock-free hand-off of snapshots from the logic thread to the render thread.
+ *
+ * The logic thread fills back() and publishes it; the render thread keeps drawing its front
+ * snapshot until a newer one has been published. A third slot holds the latest published
+ * snapshot between the two, so neither thread ever waits on or writes to the other's buffer.
+ */
+class FrameExchange {
+public:
+    FrameSnapshot& back() {
+        return slots[backIndex];
+    }
+
+    void publish() {
+        backIndex = ready.exchange(backIndex | FRESH, memory_order_acq_rel) & INDEX_MASK;
+    }
+
+    const FrameSnapshot& acquire() {
+        if (ready.load(memory_order_relaxed) & FRESH) {
+            frontIndex = ready.exchange(frontIndex, memory_order_acq_rel) & INDEX_MASK;
+        }
+        return slots[frontIndex];
+    }
+
+private:
+    static const int FRESH = 4;
+    static const int INDEX_MASK = 3;
+    FrameSnapshot slots[3];
+    int backIndex = 0;      // Logic thread only
+    int frontIndex = 1;     // Render thread only
+    atomic<int> ready{2};   // Slot index plus FRESH when not yet taken by the renderer
+};
+
+/**
+ * @class ImageEncodeQueue
+ * @brief Bounded queue of rendered pages that background threads encode to PNG files,
+ *        so PNG compression overlaps with rendering the next page.
+ */
+class ImageEncodeQueue {
+public:
+    explicit ImageEncodeQueue(unsigned encoderCount, size_t maxPending = 8) : capacity(maxPending) {
+        for (unsigned i = 0; i < encoderCount; ++i) {
+            encoders.emplace_back([this]() { encodeLoop(); });
+        }
+    }
+
+    ~ImageEncodeQueue() {
+        finish();
+    }
+
+    // Blocks while the queue is full so rendering cannot run far ahead of encoding
+    void push(sf::Image image, const string& filename) {
+        unique_lock<mutex> lock(queueMutex);
+        spaceAvailable.wait(lock, [this]() { return pending.size() < capacity; });
+        pending.push({move(image), filename});
+        workAvailable.notify_one();
+    }
+
+    // Waits for every queued page to be written
+    void finish() {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            if (stopping) return;
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        for (auto& encoder : encoders) {
+            encoder.join();
+        }
+    }
+
+    size_t failures() const { return failed.load(); }
+
+private:
+    struct Job {
+        sf::Image image;
+        string filename;
+    };
+
+    vector<thread> encoders;
+    queue<Job> pending;
+    size_t capacity;
+    mutex queueMutex;
+    condition_variable workAvailable;
+    condition_variable spaceAvailable;
+    bool stopping = false;
+    atomic<size_t> failed{0};
+
+    void encodeLoop() {
+        for (;;) {
+            Job job;
+            {
+                unique_lock<mutex> lock(queueMutex);
+                workAvailable.wait(lock, [this]() { return stopping || !pending.empty(); });
+                if (pending.empty()) return;
+                job = move(pending.front());
+                pending.pop();
+            }
+            spaceAvailable.notify_one();
+            if (!job.image.saveToFile(job.filename)) {
+                ++failed;
+            }
+        }
+    }
+};
+
+/**
+ * @class TranscriptApp
+ * @brief Main SFML application logic and state manager.
  */
 class TranscriptApp {
 public:
@@ -371,46 +1996,254 @@ public:
         STATE_DELETE_COURSE,
         STATE_LOAD_SAVE_CONFIRM,
         STATE_MESSAGE,
-        STATE_MESSAGE_SEM
+        STATE_MESSAGE_SEM,
+        STATE_DEGREE_AUDIT,
+        STATE_BULK_ADD_COURSES
     };
 
-    TranscriptApp() : 
-        window(sf::VideoMode(800, 700), "SFML Transcript Manager"),
+    static constexpr const char* OFFSCREEN_ERROR =
+        "Error: Could not create offscreen render target (it needs an OpenGL context; "
+        "without a display, run under an X server such as xvfb-run)";
+
+    // A headless app never opens a window; it is used for offscreen exports and replays. Render
+    // textures still need an OpenGL context, which SFML on Linux creates through GLX, so a
+    // display-less host needs an X server such as Xvfb (e.g. xvfb-run ./app --export-summary ...).
+    explicit TranscriptApp(bool headless = false) : 
         currentState(STATE_MAIN_MENU) 
     {
-        window.setFramerateLimit(60);
+        if (!headless) {
+            window.create(sf::VideoMode(800, 700), "SFML Transcript Manager");
+            window.setFramerateLimit(60);
+        }
 
         // Font Loading
-        if (!font.loadFromFile("/usr/share/fonts/truetype/freefont/FreeMono.ttf")) {
-            if (!font.loadFromFile("/usr/share/fonts/truetype/msttcorefonts/Arial.ttf")) {
-                 if (!font.loadFromFile("/System/Library/Fonts/Supplemental/Arial.ttf")) {
-                    cerr << "Error: Could not load font. Please ensure 'arial.ttf' is in the execution directory." << endl;
-                    // Fallback to a functional state but with a warning
-                }
+        for (const char* path : {"/usr/share/fonts/truetype/freefont/FreeMono.ttf",
+                                 "/usr/share/fonts/truetype/msttcorefonts/Arial.ttf",
+                                 "/System/Library/Fonts/Supplemental/Arial.ttf"}) {
+            if (font.loadFromFile(path)) {
+                fontPath = path;
+                break;
             }
         }
+        if (fontPath.empty()) {
+            cerr << "Error: Could not load font. Please ensure 'arial.ttf' is in the execution directory." << endl;
+            // Fallback to a functional state but with a warning
+        }
 
+        loadCohort("cohort");
         setupUI();
     }
 
+    /**
+     * Runs the windowed app on three threads: this one pumps window events (SFML requires the
+     * creating thread to do so), a logic thread handles them and publishes frame snapshots,
+     * and a render thread draws the newest snapshot at the frame-rate limit. Slow transcript
+     * work on the logic thread therefore never stalls drawing.
+     */
     void run() {
-        while (window.isOpen()) {
+        window.setActive(false);
+        atomic<bool> rendering(true);
+        thread logicThread([this]() { logicLoop(); });
+        thread renderThread([this, &rendering]() { renderLoop(rendering); });
+
+        sf::Event event;
+        while (!closeRequested.load()) {
+            bool received = false;
+            while (window.pollEvent(event)) {
+                lock_guard<mutex> lock(inputMutex);
+                inputQueue.push_back(event);
+                received = true;
+            }
+            if (received) {
+                inputReady.notify_one();
+            }
+            this_thread::sleep_for(chrono::milliseconds(2));
+        }
+
+        inputReady.notify_one();
+        logicThread.join();
+        rendering = false;
+        renderThread.join();
+        window.setActive(true);
+        window.close();
+    }
+
+    void requestClose() {
+        closeRequested = true;
+    }
+
+    void startRecording(const string& filename) {
+        recordFile.open(filename);
+        recordStart = chrono::steady_clock::now();
+        if (!recordFile.is_open()) {
+            cerr << "Error: Could not open " << filename << " for recording" << endl;
+        }
+    }
+
+    /**
+     * Feeds a recorded session back through handleEvents/update/render against an offscreen
+     * target as fast as possible, one recorded frame at a time, and reports frame timing,
+     * allocations and the final transcript. Returns 2 when maxP99Us is set and exceeded.
+     * The session runs for real (Save/Load touch transcript.csv), so replay in a scratch
+     * directory that holds the files the recording started from.
+     */
+    int replay(const string& filename, double maxP99Us) {
+        vector<RecordedEvent> recording;
+        if (!loadRecording(filename, recording)) {
+            cerr << "Error: Could not read recording " << filename << endl;
+            return 1;
+        }
+        if (!offscreen.create(800, 700)) {
+            cerr << OFFSCREEN_ERROR << endl;
+            return 1;
+        }
+        replaying = true;
+
+        vector<double> frameMicros;
+        vector<uint64_t> frameAllocations;
+        size_t next = 0;
+        setAllocationCounting(true);
+        auto sessionStart = chrono::steady_clock::now();
+        while (next < recording.size()) {
+            uint64_t frame = recording[next].frame;
+            for (; next < recording.size() && recording[next].frame == frame; ++next) {
+                if (recording[next].hasClipboard) {
+                    replayClipboard.push_back(recording[next].clipboard);
+                } else {
+                    replayEvents.push_back(recording[next].event);
+                }
+            }
+
+            uint64_t allocationsBefore = allocationCount();
+            auto frameStart = chrono::steady_clock::now();
             handleEvents();
             update();
             render();
+            chrono::duration<double, micro> elapsed = chrono::steady_clock::now() - frameStart;
+            frameMicros.push_back(elapsed.count());
+            frameAllocations.push_back(allocationCount() - allocationsBefore);
         }
+        chrono::duration<double> total = chrono::steady_clock::now() - sessionStart;
+        setAllocationCounting(false);
+        if (frameMicros.empty()) {
+            cerr << "Error: Recording has no events" << endl;
+            return 1;
+        }
+
+        vector<double> sorted = frameMicros;
+        sort(sorted.begin(), sorted.end());
+        double p99 = sorted[min(sorted.size() - 1, sorted.size() * 99 / 100)];
+        uint64_t allocations = 0;
+        for (uint64_t count : frameAllocations) {
+            allocations += count;
+        }
+        size_t courseCount = 0;
+        for (const auto& sem : transcript.semesters) {
+            courseCount += sem.courses.size();
+        }
+
+        cout << fixed << setprecision(1);
+        cout << "Replayed " << recording.size() << " events in " << frameMicros.size() << " frames ("
+             << setprecision(3) << total.count() << " s, recorded session "
+             << recording.back().timeMicros / 1e6 << " s)" << endl << setprecision(1);
+        cout << "  frame time   p50 " << sorted[sorted.size() / 2] << " us, p99 " << p99
+             << " us, max " << sorted.back() << " us" << endl;
+        cout << "  allocations  " << allocations << " total, " << allocations / frameMicros.size() << " per frame, "
+             << *max_element(frameAllocations.begin(), frameAllocations.end()) << " max" << endl;
+        cout << "  final state  " << currentState << ", student \"" << transcript.studentName << "\", "
+             << transcript.semesters.size() << " semester(s), " << courseCount << " course(s), cumulative GPA "
+             << setprecision(4) << transcript.calculateCumulativeGPA() << endl;
+
+        if (maxP99Us > 0 && p99 > maxP99Us) {
+            cerr << "FAIL: p99 frame time " << p99 << " us exceeds budget " << maxP99Us << " us" << endl;
+            return 2;
+        }
+        return 0;
+    }
+
+    /**
+     * Renders the full summary of every transcript CSV into PNG pages under outputDir,
+     * reusing one offscreen render target while encoder threads write the previous pages.
+     * No window is opened, but an X display is still required (see the constructor).
+     */
+    int exportSummaries(const vector<string>& transcriptFiles, const string& outputDir) {
+        error_code ec;
+        filesystem::create_directories(outputDir, ec);
+
+        sf::RenderTexture target;
+        if (!target.create(800, 700)) {
+            cerr << OFFSCREEN_ERROR << endl;
+            return 1;
+        }
+        ImageEncodeQueue encoder(max(2u, thread::hardware_concurrency()) - 1);
+
+        size_t pages = 0;
+        auto start = chrono::steady_clock::now();
+        for (const auto& filename : transcriptFiles) {
+            Transcript source;
+            source.loadFromCSV(filename);
+            string prefix = (filesystem::path(outputDir) / filesystem::path(filename).stem()).string();
+            pages += renderSummaryPages(target, font, source, prefix, encoder);
+        }
+        encoder.finish();
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        cout << "Exported " << pages << " page(s) from " << transcriptFiles.size() << " transcript(s) to "
+             << outputDir << " in " << fixed << setprecision(2) << elapsed.count() << " s ("
+             << setprecision(1) << pages / max(elapsed.count(), 1e-9) << " pages/s)" << endl;
+        if (encoder.failures() > 0) {
+            cerr << "Error: " << encoder.failures() << " page(s) could not be written" << endl;
+            return 1;
+        }
+        return 0;
     }
 
 private:
     sf::RenderWindow window;
+    sf::RenderTexture offscreen;   // Replay target when there is no window
+    FrameSnapshot offscreenFrame;  // Snapshot reused by single-threaded rendering
     sf::Font font;
+    string fontPath;
+
+    // Threaded run(): window events flow to the logic thread, snapshots to the render thread
+    mutex inputMutex;
+    condition_variable inputReady;
+    deque<sf::Event> inputQueue;
+    FrameExchange frames;
+    atomic<bool> closeRequested{false};
     Transcript transcript;
+    TranscriptHistory history{"transcript.history"};
+
+    // Input recording (--record) and headless replay (--replay)
+    ofstream recordFile;
+    chrono::steady_clock::time_point recordStart;
+    uint64_t frameNumber = 0;
+    bool replaying = false;
+    deque<sf::Event> replayEvents;     // Events for the frame being replayed
+    deque<string> replayClipboard;     // Clipboard text captured while recording
+    sf::Vector2i lastMousePosition;   // From MouseMoved events, so hover never queries the window
+
+    // Cohort GPAs from cohort/*.csv plus this student's current GPA once they have courses
+    GPARankIndex cohortRank;
+    map<string, double> cohortGPAs;   // Ranked cohort students by name
+    string excludedCohortName;        // Cohort entry replaced by the live transcript
+    bool studentRanked = false;
+    double rankedGPA = 0.0;
     State currentState;
     vector<Button> buttons;
     vector<InputField> inputs;
     string currentSemesterID = ""; // Used for STATE_SEMESTER_MENU and course actions
     string messageText = ""; // For STATE_MESSAGE
 
+    // For STATE_DEGREE_AUDIT
+    string auditProgramName = "";
+    vector<AuditLine> auditLines;
+    bool auditSatisfied = false;
+
+    // For STATE_BULK_ADD_COURSES
+    vector<Course> bulkRows;
+    vector<string> bulkErrors;
+
     // For scrolling the transcript view
     float viewScrollOffset = 0.0f;
     const float maxScroll = 0.0f;
@@ -435,6 +2268,7 @@ private:
             buttons.emplace_back("Save Transcript (transcript.csv)", font, x, y + (buttonHeight + spacing) * 4, buttonWidth, buttonHeight);
             buttons.emplace_back("Load Transcript (transcript.csv)", font, x, y + (buttonHeight + spacing) * 5, buttonWidth, buttonHeight);
             buttons.emplace_back("Exit", font, x, y + (buttonHeight + spacing) * 6, buttonWidth, buttonHeight);
+            buttons.emplace_back("Degree Audit (requirements.csv)", font, x + buttonWidth + 20, y, buttonWidth, buttonHeight);
 
         } else if (currentState == STATE_INPUT_STUDENT_NAME) {
             inputs.emplace_back(font, 50, 200, 300, 30, "Enter Full Name", false);
@@ -462,6 +2296,7 @@ private:
             buttons.emplace_back("Delete Course", font, x, y + (buttonHeight + spacing) * 1, buttonWidth, buttonHeight);
             buttons.emplace_back("View/Sort Courses", font, x, y + (buttonHeight + spacing) * 2, buttonWidth, buttonHeight);
             buttons.emplace_back("Back to Main Menu", font, x, y + (buttonHeight + spacing) * 3, buttonWidth, buttonHeight);
+            buttons.emplace_back("Bulk Add (Paste Courses)", font, x + buttonWidth + 20, y, buttonWidth, buttonHeight);
 
         } else if (currentState == STATE_ADD_COURSE) {
             inputs.emplace_back(font, 50, 150, 300, 30, "Course Code (e.g., CSC 319)", false);
@@ -476,22 +2311,51 @@ private:
             inputs.emplace_back(font, 50, 200, 300, 30, "Enter Course Code to Delete", false);
             buttons.emplace_back("Delete Course", font, 50, 250, 145, 30);
             buttons.emplace_back("Back", font, 205, 250, 145, 30);
+
+        } else if (currentState == STATE_VIEW_SUMMARY) {
+            buttons.emplace_back("Back to Main Menu", font, 50, 650, 150, 30); // Back button below scroll area
+            buttons.emplace_back("Export Pages (PNG)", font, 210, 650, 200, 30);
+
+        } else if (currentState == STATE_DEGREE_AUDIT) {
+            buttons.emplace_back("Back to Main Menu", font, 50, 650, 150, 30);
+
+        } else if (currentState == STATE_BULK_ADD_COURSES) {
+            buttons.emplace_back("Paste from Clipboard", font, 50, 650, 200, 30);
+            buttons.emplace_back("Add " + to_string(bulkRows.size()) + " Courses", font, 260, 650, 200, 30);
+            buttons.emplace_back("Back", font, 470, 650, 145, 30);
+            if (bulkRows.empty() || !bulkErrors.empty()) {
+                buttons[1].setInactive();
+            }
         }
     }
 
     // Event Handling 
 
     void handleEvents() {
+        TRACE_SCOPE("handleEvents");
         sf::Event event;
-        while (window.pollEvent(event)) {
+        while (nextEvent(event)) {
+            if (event.type == sf::Event::MouseMoved) {
+                lastMousePosition = {event.mouseMove.x, event.mouseMove.y};
+            }
             if (event.type == sf::Event::Closed) {
-                window.close();
+                requestClose();
             }
             if (event.type == sf::Event::TextEntered) {
                 for (auto& input : inputs) {
                     input.processInput(event.text.unicode);
                 }
             }
+            if (event.type == sf::Event::KeyPressed) {
+                // F12 dumps the trace collected so far (run with TRANSCRIPT_TRACE=<file> to enable)
+                if (event.key.code == sf::Keyboard::F12 && Tracer::isEnabled()) {
+                    Tracer::dump(Tracer::defaultPath());
+                }
+                // Ctrl+V pastes into the bulk entry view
+                if (currentState == STATE_BULK_ADD_COURSES && event.key.control && event.key.code == sf::Keyboard::V) {
+                    pasteBulkCourses();
+                }
+            }
             if (event.type == sf::Event::MouseButtonPressed) {
                 if (event.mouseButton.button == sf::Mouse::Left) {
                     handleMouseClick(event.mouseButton.x, event.mouseButton.y);
@@ -504,8 +2368,80 @@ private:
                     // Clamp the offset
                     viewScrollOffset = max(viewScrollOffset, 0.0f);
                 }
+                // The audit list scrolls upward from its starting position
+                if (currentState == STATE_DEGREE_AUDIT && event.mouseWheelScroll.delta != 0) {
+                    viewScrollOffset += event.mouseWheelScroll.delta * 25.0f;
+                    viewScrollOffset = min(viewScrollOffset, 0.0f);
+                }
+            }
+        }
+    }
+
+    // Replayed events for this frame, otherwise events pumped from the window (recorded when --record is on)
+    bool nextEvent(sf::Event& event) {
+        if (replaying) {
+            if (replayEvents.empty()) return false;
+            event = replayEvents.front();
+            replayEvents.pop_front();
+            return true;
+        }
+        {
+            lock_guard<mutex> lock(inputMutex);
+            if (inputQueue.empty()) return false;
+            event = inputQueue.front();
+            inputQueue.pop_front();
+        }
+        if (recordFile.is_open()) {
+            recordFile << frameNumber << " " << recordMicros() << " " << serializeEvent(event) << "\n";
+        }
+        return true;
+    }
+
+    uint64_t recordMicros() const {
+        return (uint64_t)chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - recordStart).count();
+    }
+
+    // The clipboard is captured in recordings so replays paste the same text
+    string readClipboard() {
+        if (replaying) {
+            if (replayClipboard.empty()) return "";
+            string text = replayClipboard.front();
+            replayClipboard.pop_front();
+            return text;
+        }
+        basic_string<sf::Uint8> utf8 = sf::Clipboard::getString().toUtf8();
+        string text(utf8.begin(), utf8.end());
+        if (recordFile.is_open()) {
+            recordFile << frameNumber << " " << recordMicros() << " " << serializeClipboard(text) << "\n";
+        }
+        return text;
+    }
+
+    void logicLoop() {
+        while (!closeRequested.load()) {
+            {
+                // Wake for input, or at least once per 60 Hz frame to refresh hover state
+                unique_lock<mutex> lock(inputMutex);
+                inputReady.wait_for(lock, chrono::milliseconds(16), [this]() {
+                    return !inputQueue.empty() || closeRequested.load();
+                });
             }
+            handleEvents();
+            update();
+            buildFrame(frames.back());
+            frames.publish();
+            ++frameNumber;
+        }
+    }
+
+    void renderLoop(atomic<bool>& rendering) {
+        window.setActive(true);
+        while (rendering.load()) {
+            TRACE_SCOPE("render");
+            drawFrame(window, frames.acquire(), font);
+            window.display();
         }
+        window.setActive(false);
     }
 
     void handleMouseClick(int x, int y) {
@@ -528,12 +2464,17 @@ private:
                 setState(STATE_VIEW_SUMMARY);
             } else if (buttons[4].isClicked(x, y)) { // Save
                 transcript.saveToCSV("transcript.csv");
-                setMessage("Transcript saved to transcript.csv!");
+                int version = history.record(transcript);
+                setMessage("Transcript saved to transcript.csv!" +
+                           (version > 0 ? " (history version " + to_string(version) + ")" : string()));
             } else if (buttons[5].isClicked(x, y)) { // Load
                 transcript.loadFromCSV("transcript.csv");
+                onTranscriptChanged();
                 setMessage("Transcript loaded from transcript.csv!");
             } else if (buttons[6].isClicked(x, y)) { // Exit
-                window.close();
+                requestClose();
+            } else if (buttons[7].isClicked(x, y)) { // Degree Audit
+                runDegreeAudit();
             } else if (Semester* sem = checkSemesterClick(x, y)) { // Clicked on a semester name in the main menu
                 currentSemesterID = sem->semesterID;
                 setState(STATE_SEMESTER_MENU);
@@ -542,6 +2483,7 @@ private:
         } else if (currentState == STATE_INPUT_STUDENT_NAME) {
             if (buttons[0].isClicked(x, y)) { // Save Name
                 transcript.studentName = inputs[0].text.empty() ? "No Student Name Set" : inputs[0].text;
+                onTranscriptChanged();
                 setMessage("Student name updated to: " + transcript.studentName);
             } else if (buttons[1].isClicked(x, y)) { // Back
                 setState(STATE_MAIN_MENU);
@@ -570,6 +2512,7 @@ private:
         } else if (currentState == STATE_DELETE_SEMESTER) {
             if (buttons[0].isClicked(x, y)) { // Delete Semester
                 if (transcript.deleteSemester(inputs[0].text)) {
+                    onTranscriptChanged();
                     setMessage("Semester " + inputs[0].text + " deleted.");
                 } else {
                     setMessage("Error: Semester " + inputs[0].text + " not found!");
@@ -581,6 +2524,8 @@ private:
         } else if (currentState == STATE_VIEW_SUMMARY) {
             if (buttons[0].isClicked(x, y)) { // Back
                 setState(STATE_MAIN_MENU);
+            } else if (buttons[1].isClicked(x, y)) { // Export Pages
+                exportCurrentSummary();
             } else if (Semester* sem = checkSemesterClick(x, y)) { // Clicked on a semester name in the summary
                 currentSemesterID = sem->semesterID;
                 setState(STATE_SEMESTER_MENU);
@@ -596,6 +2541,10 @@ private:
                 setState(STATE_VIEW_SUMMARY); // Uses the same view, but will focus on the single semester
             } else if (buttons[3].isClicked(x, y)) { // Back
                 setState(STATE_MAIN_MENU);
+            } else if (buttons[4].isClicked(x, y)) { // Bulk Add
+                bulkRows.clear();
+                bulkErrors.clear();
+                setState(STATE_BULK_ADD_COURSES);
             }
 
         } else if (currentState == STATE_ADD_COURSE) {
@@ -610,6 +2559,7 @@ private:
                             inputs[3].text  // Grade
                         };
                         sem->courses.push_back(newCourse);
+                        onTranscriptChanged();
                         setMessageSem("Course " + newCourse.courseCode + " added to " + currentSemesterID);
                     } catch (...) {
                         setMessageSem("Error: Invalid input for Credits.");
@@ -621,285 +2571,1424 @@ private:
                 setState(STATE_SEMESTER_MENU);
             }
 
-        } else if (currentState == STATE_DELETE_COURSE) {
-            if (buttons[0].isClicked(x, y)) { // Delete Course
-                Semester* sem = transcript.findSemester(currentSemesterID);
-                if (sem) {
-                    if (sem->deleteCourse(inputs[0].text)) {
-                        setMessage("Course " + inputs[0].text + " deleted from " + currentSemesterID);
-                    } else {
-                        setMessage("Error: Course " + inputs[0].text + " not found in semester " + currentSemesterID);
-                    }
-                }
-            } else if (buttons[1].isClicked(x, y)) { // Back
-                setState(STATE_SEMESTER_MENU);
+        } else if (currentState == STATE_DELETE_COURSE) {
+            if (buttons[0].isClicked(x, y)) { // Delete Course
+                Semester* sem = transcript.findSemester(currentSemesterID);
+                if (sem) {
+                    if (sem->deleteCourse(inputs[0].text)) {
+                        onTranscriptChanged();
+                        setMessage("Course " + inputs[0].text + " deleted from " + currentSemesterID);
+                    } else {
+                        setMessage("Error: Course " + inputs[0].text + " not found in semester " + currentSemesterID);
+                    }
+                }
+            } else if (buttons[1].isClicked(x, y)) { // Back
+                setState(STATE_SEMESTER_MENU);
+            }
+        } else if (currentState == STATE_MESSAGE) {
+            if (buttons[0].isClicked(x, y)) { // OK/Back
+                setState(STATE_MAIN_MENU);
+            }
+        } else if (currentState == STATE_MESSAGE_SEM) {
+            if (buttons[0].isClicked(x, y)) { // OK/Back
+                setState(STATE_SEMESTER_MENU);
+            }
+        } else if (currentState == STATE_DEGREE_AUDIT) {
+            if (buttons[0].isClicked(x, y)) { // Back
+                setState(STATE_MAIN_MENU);
+            }
+        } else if (currentState == STATE_BULK_ADD_COURSES) {
+            if (buttons[0].isClicked(x, y)) { // Paste
+                pasteBulkCourses();
+            } else if (buttons[1].isClicked(x, y)) { // Add all rows
+                commitBulkCourses();
+            } else if (buttons[2].isClicked(x, y)) { // Back
+                setState(STATE_SEMESTER_MENU);
+            }
+        }
+    }
+
+    void pasteBulkCourses() {
+        parseCourseRows(readClipboard(), bulkRows, bulkErrors);
+        setState(STATE_BULK_ADD_COURSES); // Rebuild buttons with the new row count
+    }
+
+    // All rows go in with one append and one sort, only when every pasted line is valid
+    void commitBulkCourses() {
+        Semester* sem = transcript.findSemester(currentSemesterID);
+        if (!sem || bulkRows.empty() || !bulkErrors.empty()) return;
+
+        sem->courses.reserve(sem->courses.size() + bulkRows.size());
+        sem->courses.insert(sem->courses.end(), bulkRows.begin(), bulkRows.end());
+        sem->sortByCourseNumber();
+        onTranscriptChanged();
+
+        setMessageSem(to_string(bulkRows.size()) + " courses added to " + currentSemesterID);
+        bulkRows.clear();
+    }
+
+    // Runs on the logic thread, so it loads its own font rather than sharing the renderer's glyph cache
+    void exportCurrentSummary() {
+        sf::Font pageFont;
+        sf::RenderTexture target;
+        if (!pageFont.loadFromFile(fontPath) || !target.create(800, 700)) {
+            setMessage("Error: Could not create offscreen render target");
+            return;
+        }
+        ImageEncodeQueue encoder(max(2u, thread::hardware_concurrency()) - 1);
+        error_code ec;
+        filesystem::create_directories("summary_export", ec);
+        size_t pages = renderSummaryPages(target, pageFont, transcript, "summary_export/transcript", encoder);
+        encoder.finish();
+        setMessage("Exported " + to_string(pages) + " page(s) to summary_export/");
+    }
+
+    void loadCohort(const string& directory) {
+        error_code ec;
+        vector<Transcript> cohort;
+        for (const auto& entry : filesystem::directory_iterator(directory, ec)) {
+            if (entry.path().extension() == ".csv") {
+                cohort.emplace_back();
+                cohort.back().loadFromCSV(entry.path().string());
+            }
+        }
+        if (cohort.empty()) return;
+
+        CohortColumns columns;
+        columns.build(cohort);
+        vector<double> semesterGPAs, cumulativeGPAs;
+        computeCohortGPAs(columns, semesterGPAs, cumulativeGPAs);
+        for (size_t i = 0; i < cohort.size(); ++i) {
+            if (hasCourses(cohort[i])) {
+                cohortRank.insert(cumulativeGPAs[i]);
+                cohortGPAs[cohort[i].studentName] = cumulativeGPAs[i];
+            }
+        }
+    }
+
+    // Only students with at least one course are ranked, in the cohort and for the current student
+    static bool hasCourses(const Transcript& source) {
+        return any_of(source.semesters.begin(), source.semesters.end(),
+                      [](const Semester& sem) { return !sem.courses.empty(); });
+    }
+
+    // Call after anything that can change the cumulative GPA; keeps the rank index current
+    void onTranscriptChanged() {
+        // If cohort/ also holds this student's file, the live transcript stands in for it
+        if (transcript.studentName != excludedCohortName) {
+            auto previous = cohortGPAs.find(excludedCohortName);
+            if (previous != cohortGPAs.end()) {
+                cohortRank.insert(previous->second);
+            }
+            excludedCohortName.clear();
+            auto own = cohortGPAs.find(transcript.studentName);
+            if (own != cohortGPAs.end()) {
+                cohortRank.erase(own->second);
+                excludedCohortName = own->first;
+            }
+        }
+
+        bool ranked = hasCourses(transcript);
+        double gpa = transcript.calculateCumulativeGPA();
+
+        if (studentRanked && ranked) {
+            cohortRank.update(rankedGPA, gpa);
+        } else if (studentRanked) {
+            cohortRank.erase(rankedGPA);
+        } else if (ranked) {
+            cohortRank.insert(gpa);
+        }
+        studentRanked = ranked;
+        rankedGPA = gpa;
+    }
+
+    string cohortRankText() const {
+        if (!studentRanked || cohortRank.size() < 2) return "";
+
+        int percentile = (int)cohortRank.percentile(rankedGPA);
+        int lastTwo = percentile % 100;
+        string suffix = (lastTwo >= 11 && lastTwo <= 13) ? "th"
+                      : percentile % 10 == 1 ? "st" : percentile % 10 == 2 ? "nd" : percentile % 10 == 3 ? "rd" : "th";
+        return to_string(percentile) + suffix + " percentile (rank " + to_string(cohortRank.rank(rankedGPA)) +
+               " of " + to_string(cohortRank.size()) + ")";
+    }
+
+    void runDegreeAudit() {
+        DegreeRequirements requirements;
+        if (!requirements.loadFromCSV("requirements.csv")) {
+            setMessage("Error: Could not open requirements.csv");
+            return;
+        }
+
+        CourseCatalog catalog;
+        CompiledAudit audit(requirements, catalog);
+        catalog.addTranscript(transcript);
+        AuditResult result = audit.audit(transcript, catalog);
+
+        auditProgramName = requirements.programName;
+        auditLines = describeAudit(requirements, result);
+        auditSatisfied = result.satisfied;
+        viewScrollOffset = 0.0f;
+        setState(STATE_DEGREE_AUDIT);
+    }
+
+    // Checks if a click occurred on a Semester ID in the display area
+    Semester* checkSemesterClick(int mouseX, int mouseY) {
+        float currentY = 0.0f; 
+        
+        if (currentState == STATE_MAIN_MENU) {
+            currentY = 525.0f; // Semester list starts here in Main Menu
+        } else if (currentState == STATE_VIEW_SUMMARY) {
+            currentY = 200.0f + ((1.35) * viewScrollOffset);
+        } else {
+            return nullptr;
+        }
+
+        const float rowHeight = 25.0f;
+        const float xStart = 50.0f;
+        const float xEnd = 750.0f; 
+
+        if (mouseX < xStart || mouseX > xEnd) return nullptr;
+
+        for (auto& sem : transcript.semesters) {
+            if (mouseY > currentY && mouseY < currentY + rowHeight) {
+                return &sem;
+            }
+            if (currentState == STATE_MAIN_MENU) {
+                currentY += rowHeight;
+            }
+            // In summary view, skip past course details
+            if (currentState == STATE_VIEW_SUMMARY) {
+                currentY += (sem.courses.size() + 2) * rowHeight;
+            }
+        }
+        return nullptr;
+    }
+
+    void setState(State newState) {
+        TRACE_SCOPE("setState", newState);
+        currentState = newState;
+        setupUI();
+    }
+
+    void setMessage(const string& msg) {
+        messageText = msg;
+        setState(STATE_MESSAGE);
+        buttons.clear();
+        buttons.emplace_back("OK", font, 350, 400, 100, 40);
+    }
+
+    void setMessageSem(const string& msg) {
+        messageText = msg;
+        setState(STATE_MESSAGE_SEM);
+        buttons.clear();
+        buttons.emplace_back("OK", font, 350, 400, 100, 40);
+    }
+
+    // Rendering
+
+    void update() {
+        // Handle button hover effects
+        sf::Vector2i mousePos = lastMousePosition;
+        for (auto& btn : buttons) {
+            btn.setHover(btn.isClicked(mousePos.x, mousePos.y));
+        }
+    }
+
+    // Single-threaded rendering for headless replays
+    void render() {
+        TRACE_SCOPE("render");
+        buildFrame(offscreenFrame);
+        drawFrame(offscreen, offscreenFrame, font);
+        offscreen.display();
+    }
+
+    // Turns the current model and UI state into a snapshot; never touches the font or a render target
+    void buildFrame(FrameSnapshot& frame) {
+        TRACE_SCOPE("buildFrame");
+        frame.reset(sf::Color(175, 150, 150)); // Dark background
+
+        string title;
+        string subtitle;
+
+        if (currentState == STATE_MAIN_MENU) {
+            title = "Transcript Manager: Main Menu";
+            subtitle = "Student: " + transcript.studentName + " | Cumulative GPA: " + 
+                                formatGPA(transcript.calculateCumulativeGPA());
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+            drawText(frame, subtitle, 50, 60, 18, sf::Color(200, 200, 200));
+            
+            // List of semesters (for quick access)
+            float y = 500.0f;
+            drawText(frame, "Existing Semesters (Click to Enter):", 50, y, 16, sf::Color::Yellow);
+            y += 30;
+            for (const auto& sem : transcript.semesters) {
+                drawText(frame, sem.semesterID, 50, y, 14, sf::Color::White);
+                y += 25;
+            }
+
+        } else if (currentState == STATE_VIEW_SUMMARY) {
+            if (!currentSemesterID.empty() && currentSemesterID != "ALL") {
+                // Viewing a single semester
+                title = "Semester Details: " + currentSemesterID;
+                subtitle = "Click on 'Back' or a semester ID to return.";
+            } else {
+                // Viewing the full transcript
+                title = "Full Transcript Summary";
+                subtitle = "Student: " + transcript.studentName + " | Cumulative GPA: " + 
+                                formatGPA(transcript.calculateCumulativeGPA());
+                currentSemesterID = "ALL"; // Clear focus
+                // Own line between the subtitle and the scroll area, so long names cannot push it off-screen
+                drawText(frame, cohortRankText(), 50, 80, 14, sf::Color(150, 150, 150));
+            }
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+            drawText(frame, subtitle, 50, 60, 18, sf::Color(200, 200, 200));
+            
+            drawSummary(frame);
+
+        } else if (currentState == STATE_INPUT_STUDENT_NAME) {
+            title = "Enter Student Name";
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+
+        } else if (currentState == STATE_ADD_SEMESTER) {
+            title = "Add New Semester";
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+
+        } else if (currentState == STATE_DELETE_SEMESTER) {
+            title = "Delete Semester";
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+
+        } else if (currentState == STATE_SEMESTER_MENU) {
+            title = "Semester Manager: " + currentSemesterID;
+            
+            Semester* sem = transcript.findSemester(currentSemesterID);
+            if (sem) {
+                float gpa = round(sem->calculateSemesterGPA() * 100) / 100.0f;
+                subtitle = "Semester GPA: " + to_string(gpa);
+            } else {
+                subtitle = "Error: Semester not found.";
+            }
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+            drawText(frame, subtitle, 50, 60, 18, sf::Color(200, 200, 200));
+
+        } else if (currentState == STATE_ADD_COURSE) {
+            title = "Add Course to " + currentSemesterID;
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+            drawText(frame, "Note: Credits must be a whole number (e.g., 3).", 50, 100, 14, sf::Color(255, 150, 150));
+
+        } else if (currentState == STATE_DELETE_COURSE) {
+            title = "Delete Course from " + currentSemesterID;
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+        } else if (currentState == STATE_MESSAGE) {
+             title = "Notification";
+             drawText(frame, title, 50, 20, 24, sf::Color::White);
+             drawText(frame, messageText, 50, 200, 18, sf::Color::Cyan);
+        } else if (currentState == STATE_MESSAGE_SEM) {
+             title = "Notification";
+             drawText(frame, title, 50, 20, 24, sf::Color::White);
+             drawText(frame, messageText, 50, 200, 18, sf::Color::Cyan);
+        } else if (currentState == STATE_DEGREE_AUDIT) {
+            title = "Degree Audit: " + auditProgramName;
+            size_t missingCount = count_if(auditLines.begin(), auditLines.end(), [](const AuditLine& line) { return !line.met; });
+            subtitle = "Student: " + transcript.studentName + " | " +
+                               (auditSatisfied ? string("All requirements satisfied") : to_string(missingCount) + " requirement(s) missing");
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+            drawText(frame, subtitle, 50, 60, 18, sf::Color(200, 200, 200));
+
+            float y = 110.0f + viewScrollOffset;
+            for (const auto& line : auditLines) {
+                if (y >= 100.0f && y < 620.0f) {
+                    drawText(frame, (line.met ? "[OK]      " : "[MISSING] ") + line.text, 50, y, 16,
+                             line.met ? sf::Color::Green : sf::Color(255, 220, 220));
+                }
+                y += 22;
+            }
+        } else if (currentState == STATE_BULK_ADD_COURSES) {
+            title = "Bulk Add Courses to " + currentSemesterID;
+            subtitle = "Paste rows: Code, Name, Credits, Grade (tab or comma separated)";
+            drawText(frame, title, 50, 20, 24, sf::Color::White);
+            drawText(frame, subtitle, 50, 60, 18, sf::Color(200, 200, 200));
+
+            float y = 100.0f;
+            drawText(frame, to_string(bulkRows.size()) + " valid row(s), " + to_string(bulkErrors.size()) + " error(s)",
+                     50, y, 16, bulkErrors.empty() ? sf::Color::Yellow : sf::Color(255, 150, 150));
+            y += 30;
+            for (const auto& error : bulkErrors) {
+                if (y >= 620.0f) break;
+                drawText(frame, error, 50, y, 14, sf::Color(255, 150, 150));
+                y += 20;
+            }
+            for (const auto& course : bulkRows) {
+                if (y >= 620.0f) break;
+                drawTable(frame, y, course.courseCode,
+                          course.courseName.length() > 25 ? course.courseName.substr(0, 22) + "..." : course.courseName,
+                          to_string(course.credits), course.grade, sf::Color::White);
+                y += 20;
+            }
+        }
+
+        // General UI elements (buttons/inputs) are drawn over the content
+        frame.buttons = buttons;
+        frame.inputs = inputs;
+    }
+
+    static void drawFrame(sf::RenderTarget& target, const FrameSnapshot& frame, const sf::Font& font) {
+        sf::View view(sf::FloatRect(0, 0, 800, 700)); // Default view
+        target.setView(view);
+        target.clear(frame.background);
+
+        for (const auto& command : frame.commands) {
+            if (command.kind == DrawCommand::TEXT) {
+                sf::Text txt(sf::String::fromUtf8(command.text.begin(), command.text.end()), font, command.size);
+                txt.setFillColor(command.color);
+                txt.setPosition(command.x, command.y);
+                target.draw(txt);
+            } else if (command.kind == DrawCommand::RECT) {
+                sf::RectangleShape rect({command.width, command.height});
+                rect.setPosition(command.x, command.y);
+                rect.setFillColor(command.color);
+                target.draw(rect);
+            } else if (command.kind == DrawCommand::SCROLL_VIEW) {
+                // Adjust view to enable scrolling within the visible area
+                sf::View scrollableView = view;
+                scrollableView.setViewport(sf::FloatRect(50.0f / 800.0f, 100.0f / 700.0f, 700.0f / 800.0f, 500.0f / 700.0f));
+                scrollableView.setCenter(400, 350 - command.y);
+                target.setView(scrollableView);
+            } else {
+                target.setView(view);
+            }
+        }
+
+        for (const auto& btn : frame.buttons) {
+            btn.draw(target);
+        }
+        for (const auto& input : frame.inputs) {
+            input.draw(target);
+        }
+    }
+
+    void drawSummary(FrameSnapshot& frame) {
+        TRACE_SCOPE("drawSummary");
+        // Clip/Scroll Area Rectangle (50, 100) to (750, 600)
+        frame.addRect(50, 100, 700, 480, sf::Color(40, 40, 40));
+
+        // Content scrolls inside the clip area (to hide content that scrolls off screen)
+        frame.addView(DrawCommand::SCROLL_VIEW, viewScrollOffset);
+
+        vector<Semester> singleSemester;
+        const vector<Semester>* semestersToDisplay = &transcript.semesters;
+        if (currentSemesterID != "ALL") {
+            Semester* sem = transcript.findSemester(currentSemesterID);
+            if (sem) {
+                singleSemester.push_back(*sem);
+                semestersToDisplay = &singleSemester;
+            }
+        }
+
+        float currentY = 150.0f + viewScrollOffset;
+        for (const auto& line : layoutSummary(*semestersToDisplay)) {
+            drawSummaryLine(frame, line, currentY);
+            currentY += line.height;
+        }
+
+        // Restore original view for drawing elements outside the scroll area
+        frame.addView(DrawCommand::DEFAULT_VIEW);
+    }
+
+    // Flattens semesters into the summary's header, table and GPA lines
+    static vector<SummaryLine> layoutSummary(const vector<Semester>& semesters) {
+        const float rowHeight = 25.0f;
+        vector<SummaryLine> lines;
+
+        for (const auto& semester : semesters) {
+            lines.push_back({SummaryLine::SEMESTER_HEADER, {"--- Semester: " + semester.semesterID + " ---"}, rowHeight});
+            lines.push_back({SummaryLine::COLUMN_HEADER, {"Course", "Name", "Credits", "Grade"}, rowHeight});
+
+            for (const auto& course : semester.courses) {
+                lines.push_back({SummaryLine::COURSE_ROW, {
+                    course.courseCode,
+                    course.courseName.length() > 25 ? course.courseName.substr(0, 22) + "..." : course.courseName, // Truncate long names
+                    to_string(course.credits),
+                    course.grade}, rowHeight});
+            }
+
+            float gpa = round(semester.calculateSemesterGPA() * 100) / 100.0f;
+            lines.push_back({SummaryLine::SEMESTER_GPA, {"Semester GPA: " + to_string(gpa)}, rowHeight * 1.5f});
+        }
+        return lines;
+    }
+
+    static void drawSummaryLine(FrameSnapshot& window, const SummaryLine& line, float y) {
+        switch (line.kind) {
+            case SummaryLine::SEMESTER_HEADER:
+                drawText(window, line.cells[0], 50, y, 18, sf::Color::Yellow);
+                break;
+            case SummaryLine::COLUMN_HEADER:
+                drawTable(window, y, line.cells[0], line.cells[1], line.cells[2], line.cells[3], sf::Color(150, 150, 150));
+                break;
+            case SummaryLine::COURSE_ROW:
+                drawTable(window, y, line.cells[0], line.cells[1], line.cells[2], line.cells[3], sf::Color::White);
+                break;
+            case SummaryLine::SEMESTER_GPA:
+                drawText(window, line.cells[0], 50, y, 16, sf::Color::Green);
+                break;
+        }
+    }
+
+    /**
+     * Paginates the full summary of source into 800x700 pages (lines never split across
+     * pages), renders each into target and hands the images to the encoder. Returns the
+     * number of pages.
+     */
+    size_t renderSummaryPages(sf::RenderTexture& target, const sf::Font& pageFont, const Transcript& source,
+                              const string& pathPrefix, ImageEncodeQueue& encoder) {
+        const float top = 100.0f;
+        const float bottom = 640.0f;
+
+        vector<SummaryLine> lines = layoutSummary(source.semesters);
+        vector<size_t> pageStarts = {0};
+        float used = 0.0f;
+        for (size_t i = 0; i < lines.size(); ++i) {
+            if (used + lines[i].height > bottom - top && used > 0.0f) {
+                pageStarts.push_back(i);
+                used = 0.0f;
+            }
+            used += lines[i].height;
+        }
+        pageStarts.push_back(lines.size());
+
+        string gpaText = formatGPA(source.calculateCumulativeGPA());
+        size_t pageCount = pageStarts.size() - 1;
+        FrameSnapshot frame;
+        for (size_t page = 0; page < pageCount; ++page) {
+            frame.reset(sf::Color(40, 40, 40));
+            drawText(frame, "Full Transcript Summary", 50, 20, 24, sf::Color::White);
+            drawText(frame, "Student: " + source.studentName + " | Cumulative GPA: " + gpaText, 50, 60, 18, sf::Color(200, 200, 200));
+            drawText(frame, "Page " + to_string(page + 1) + " of " + to_string(pageCount), 50, 660, 14, sf::Color(150, 150, 150));
+
+            float y = top;
+            for (size_t i = pageStarts[page]; i < pageStarts[page + 1]; ++i) {
+                drawSummaryLine(frame, lines[i], y);
+                y += lines[i].height;
+            }
+            drawFrame(target, frame, pageFont);
+            target.display();
+            encoder.push(target.getTexture().copyToImage(), pathPrefix + "_page" + to_string(page + 1) + ".png");
+        }
+        return pageCount;
+    }
+
+    static string formatGPA(double gpa) {
+        ostringstream text;
+        text << fixed << setprecision(2) << gpa;
+        return text.str();
+    }
+
+    // Helper to draw a single line of text with custom color/size
+    static void drawText(FrameSnapshot& window, const string& str, float x, float y, unsigned int size, const sf::Color& color) {
+        window.addText(str, x, y, size, color);
+    }
+
+    // Helper to draw a formatted table row
+    static void drawTable(FrameSnapshot& window, float y, const string& col1, const string& col2, const string& col3, const string& col4, const sf::Color& color) {
+        drawText(window, col1, 50, y, 14, color);     // Course Code
+        drawText(window, col2, 170, y, 14, color);    // Name
+        drawText(window, col3, 470, y, 14, color);    // Credits
+        drawText(window, col4, 570, y, 14, color);    // Grade
+    }
+};
+
+// Query Service
+
+/**
+ * @class ThreadPool
+ * @brief Fixed-size pool of worker threads draining a FIFO task queue.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned threadCount) {
+        for (unsigned i = 0; i < threadCount; ++i) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            stopping = true;
+        }
+        queueReady.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void submit(function<void()> task) {
+        {
+            lock_guard<mutex> lock(queueMutex);
+            tasks.push(move(task));
+        }
+        queueReady.notify_one();
+    }
+
+private:
+    vector<thread> workers;
+    queue<function<void()>> tasks;
+    mutex queueMutex;
+    condition_variable queueReady;
+    bool stopping = false;
+
+    void workerLoop() {
+        for (;;) {
+            function<void()> task;
+            {
+                unique_lock<mutex> lock(queueMutex);
+                queueReady.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) return;
+                task = move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+};
+
+/**
+ * @class TranscriptStore
+ * @brief Transcripts keyed by student name behind a reader/writer lock.
+ *
+ * Requests are single tab-separated lines; replies start with "OK" or "ERR":
+ *   STUDENTS
+ *   GPA      <student>
+ *   SEMGPA   <student> <semesterID>
+ *   COURSES  <student>                    -> OK <count> then one <sem>|<code>|<name>|<credits>|<grade> field per course
+ *   ADD      <student> <semesterID> <code> <name> <credits> <grade>
+ *   DELETE   <student> <semesterID> <code>
+ */
+class TranscriptStore {
+public:
+    void add(const Transcript& transcript) {
+        unique_lock<shared_mutex> lock(storeMutex);
+        transcripts[transcript.studentName] = transcript;
+    }
+
+    size_t size() const {
+        shared_lock<shared_mutex> lock(storeMutex);
+        return transcripts.size();
+    }
+
+    string handleRequest(const string& request) {
+        vector<string> fields;
+        stringstream ss(request);
+        string field;
+        while (getline(ss, field, '\t')) {
+            fields.push_back(field);
+        }
+        if (fields.empty()) return "ERR\tEmpty request";
+
+        const string& command = fields[0];
+        if (command == "ADD" || command == "DELETE") {
+            unique_lock<shared_mutex> lock(storeMutex);
+            return handleWrite(fields);
+        }
+        shared_lock<shared_mutex> lock(storeMutex);
+        return handleRead(fields);
+    }
+
+private:
+    mutable shared_mutex storeMutex;
+    map<string, Transcript> transcripts;
+
+    string handleRead(const vector<string>& fields) const {
+        const string& command = fields[0];
+        if (command == "STUDENTS") {
+            string reply = "OK\t" + to_string(transcripts.size());
+            for (const auto& entry : transcripts) {
+                reply += "\t" + entry.first;
             }
-        } else if (currentState == STATE_MESSAGE) {
-            if (buttons[0].isClicked(x, y)) { // OK/Back
-                setState(STATE_MAIN_MENU);
+            return reply;
+        }
+        if (command != "GPA" && command != "SEMGPA" && command != "COURSES") return "ERR\tUnknown request";
+        if (fields.size() < 2) return "ERR\tMissing student";
+
+        auto it = transcripts.find(fields[1]);
+        if (it == transcripts.end()) return "ERR\tStudent not found";
+        const Transcript& transcript = it->second;
+
+        if (command == "GPA") {
+            return "OK\t" + to_string(transcript.calculateCumulativeGPA());
+        } else if (command == "SEMGPA" && fields.size() >= 3) {
+            for (const auto& semester : transcript.semesters) {
+                if (semester.semesterID == fields[2]) {
+                    return "OK\t" + to_string(semester.calculateSemesterGPA());
+                }
             }
-        } else if (currentState == STATE_MESSAGE_SEM) {
-            if (buttons[0].isClicked(x, y)) { // OK/Back
-                setState(STATE_SEMESTER_MENU);
+            return "ERR\tSemester not found";
+        } else if (command == "COURSES") {
+            string body;
+            size_t count = 0;
+            for (const auto& semester : transcript.semesters) {
+                for (const auto& course : semester.courses) {
+                    body += "\t" + semester.semesterID + "|" + course.courseCode + "|" + course.courseName + "|" +
+                            to_string(course.credits) + "|" + course.grade;
+                    ++count;
+                }
             }
+            return "OK\t" + to_string(count) + body;
         }
+        return "ERR\tUnknown request";
     }
 
-    // Checks if a click occurred on a Semester ID in the display area
-    Semester* checkSemesterClick(int mouseX, int mouseY) {
-        float currentY = 0.0f; 
-        
-        if (currentState == STATE_MAIN_MENU) {
-            currentY = 525.0f; // Semester list starts here in Main Menu
-        } else if (currentState == STATE_VIEW_SUMMARY) {
-            currentY = 200.0f + ((1.35) * viewScrollOffset);
-        } else {
-            return nullptr;
-        }
-
-        const float rowHeight = 25.0f;
-        const float xStart = 50.0f;
-        const float xEnd = 750.0f; 
+    string handleWrite(const vector<string>& fields) {
+        if (fields.size() < 4) return "ERR\tMissing fields";
 
-        if (mouseX < xStart || mouseX > xEnd) return nullptr;
+        auto it = transcripts.find(fields[1]);
+        if (it == transcripts.end()) return "ERR\tStudent not found";
+        Transcript& transcript = it->second;
 
-        for (auto& sem : transcript.semesters) {
-            if (mouseY > currentY && mouseY < currentY + rowHeight) {
-                return &sem;
-            }
-            if (currentState == STATE_MAIN_MENU) {
-                currentY += rowHeight;
+        if (fields[0] == "ADD") {
+            if (fields.size() < 7) return "ERR\tMissing fields";
+            int credits;
+            try {
+                credits = stoi(fields[5]);
+            } catch (...) {
+                return "ERR\tInvalid credits";
             }
-            // In summary view, skip past course details
-            if (currentState == STATE_VIEW_SUMMARY) {
-                currentY += (sem.courses.size() + 2) * rowHeight;
+
+            Semester* semester = transcript.findSemester(fields[2]);
+            if (semester == nullptr) {
+                transcript.semesters.push_back(Semester{fields[2], {}});
+                sort(transcript.semesters.begin(), transcript.semesters.end(), [](const Semester& a, const Semester& b){
+                    return a.semesterID < b.semesterID;
+                });
+                semester = transcript.findSemester(fields[2]);
             }
+            semester->courses.push_back({fields[3], fields[4], credits, fields[6]});
+            return "OK";
         }
-        return nullptr;
+
+        Semester* semester = transcript.findSemester(fields[2]);
+        if (semester == nullptr) return "ERR\tSemester not found";
+        return semester->deleteCourse(fields[3]) ? "OK" : "ERR\tCourse not found";
     }
+};
 
-    void setState(State newState) {
-        currentState = newState;
-        setupUI();
+/**
+ * Answers one batch of complete request lines with a single write, so pipelined clients pay
+ * one round trip per batch. Returns false when the client can no longer be written to.
+ */
+bool answerBatch(int clientFd, const string& lines, TranscriptStore& store) {
+    string replies;
+    size_t start = 0;
+    size_t newline;
+    while ((newline = lines.find('\n', start)) != string::npos) {
+        replies += store.handleRequest(lines.substr(start, newline - start));
+        replies += '\n';
+        start = newline + 1;
     }
 
-    void setMessage(const string& msg) {
-        messageText = msg;
-        setState(STATE_MESSAGE);
-        buttons.clear();
-        buttons.emplace_back("OK", font, 350, 400, 100, 40);
+    size_t sent = 0;
+    while (sent < replies.size()) {
+        ssize_t n = send(clientFd, replies.data() + sent, replies.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += n;
+    }
+    return true;
+}
+
+int runQueryServer(const string& socketPath, const vector<string>& transcriptFiles) {
+    TranscriptStore store;
+    for (const auto& filename : transcriptFiles) {
+        Transcript transcript;
+        transcript.loadFromCSV(filename);
+        store.add(transcript);
     }
 
-    void setMessageSem(const string& msg) {
-        messageText = msg;
-        setState(STATE_MESSAGE_SEM);
-        buttons.clear();
-        buttons.emplace_back("OK", font, 350, 400, 100, 40);
+    int listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (listenFd < 0 || socketPath.size() >= sizeof(address.sun_path)) {
+        cerr << "Error: Could not create socket " << socketPath << endl;
+        return 1;
+    }
+    strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    unlink(socketPath.c_str());
+    if (::bind(listenFd, (sockaddr*)&address, sizeof(address)) < 0 || listen(listenFd, 128) < 0) {
+        cerr << "Error: Could not listen on " << socketPath << endl;
+        close(listenFd);
+        return 1;
     }
 
-    // Rendering
+    // One thread polls every connection; workers only run while answering a batch, so idle
+    // persistent clients never hold one. A connection has at most one batch in flight, which
+    // keeps its replies in request order; bytes arriving meanwhile wait in the socket buffer.
+    unsigned threadCount = max(4u, thread::hardware_concurrency());
+    ThreadPool pool(threadCount);
+    cout << "Serving " << store.size() << " transcript(s) on " << socketPath << " with " << threadCount << " threads" << endl;
+
+    // Workers hand connections back through a self-pipe that wakes the poll loop
+    int wakePipe[2];
+    if (pipe(wakePipe) < 0) {
+        cerr << "Error: Could not create wake pipe" << endl;
+        close(listenFd);
+        return 1;
+    }
+    fcntl(wakePipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(wakePipe[1], F_SETFL, O_NONBLOCK);
+    mutex finishedMutex;
+    vector<pair<int, bool>> finished; // Connection, still writable
+
+    struct Connection {
+        string pending; // Bytes after the last complete request line
+        bool busy = false;
+    };
+    map<int, Connection> connections;
+    vector<pollfd> fds;
+    char buffer[16384];
+
+    for (;;) {
+        fds.clear();
+        fds.push_back({listenFd, POLLIN, 0});
+        fds.push_back({wakePipe[0], POLLIN, 0});
+        for (const auto& entry : connections) {
+            if (!entry.second.busy) {
+                fds.push_back({entry.first, POLLIN, 0});
+            }
+        }
+        if (poll(fds.data(), fds.size(), -1) < 0) continue;
+
+        if (fds[1].revents & POLLIN) {
+            while (read(wakePipe[0], buffer, sizeof(buffer)) > 0) {}
+            lock_guard<mutex> lock(finishedMutex);
+            for (const auto& done : finished) {
+                if (done.second) {
+                    connections[done.first].busy = false;
+                } else {
+                    close(done.first);
+                    connections.erase(done.first);
+                }
+            }
+            finished.clear();
+        }
 
-    void update() {
-        // Handle button hover effects
-        sf::Vector2i mousePos = sf::Mouse::getPosition(window);
-        for (auto& btn : buttons) {
-            btn.setHover(btn.isClicked(mousePos.x, mousePos.y));
+        if (fds[0].revents & POLLIN) {
+            int clientFd = accept(listenFd, nullptr, nullptr);
+            if (clientFd >= 0) {
+                // A client that stops reading its replies only holds a worker this long
+                timeval sendTimeout = {5, 0};
+                setsockopt(clientFd, SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+                connections[clientFd];
+            }
+        }
+
+        for (size_t i = 2; i < fds.size(); ++i) {
+            if (fds[i].revents == 0) continue;
+            int clientFd = fds[i].fd;
+            Connection& connection = connections[clientFd];
+
+            ssize_t received = recv(clientFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) continue;
+            if (received <= 0) {
+                close(clientFd);
+                connections.erase(clientFd);
+                continue;
+            }
+            connection.pending.append(buffer, received);
+
+            size_t end = connection.pending.rfind('\n');
+            if (end == string::npos) continue;
+            string lines = connection.pending.substr(0, end + 1);
+            connection.pending.erase(0, end + 1);
+            connection.busy = true;
+
+            int wakeFd = wakePipe[1];
+            pool.submit([clientFd, lines, wakeFd, &store, &finishedMutex, &finished]() {
+                bool writable = answerBatch(clientFd, lines, store);
+                {
+                    lock_guard<mutex> lock(finishedMutex);
+                    finished.push_back({clientFd, writable});
+                }
+                char signal = 1;
+                if (write(wakeFd, &signal, 1) < 0) {
+                    // Pipe already full, so the poll loop is waking anyway
+                }
+            });
         }
     }
+}
+
+int connectToServer(const string& socketPath) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+    if (fd < 0 || connect(fd, (sockaddr*)&address, sizeof(address)) < 0) {
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Sends a batch of request lines and reads back the same number of reply lines
+bool exchangeBatch(int fd, const string& requests, size_t expectedReplies, string& carry, vector<string>& replies) {
+    size_t sent = 0;
+    while (sent < requests.size()) {
+        ssize_t n = send(fd, requests.data() + sent, requests.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) return false;
+        sent += n;
+    }
 
-    void render() {
-        window.clear(sf::Color(175, 150, 150)); // Dark background
+    char buffer[16384];
+    while (replies.size() < expectedReplies) {
+        size_t newline = carry.find('\n');
+        if (newline != string::npos) {
+            replies.push_back(carry.substr(0, newline));
+            carry.erase(0, newline + 1);
+            continue;
+        }
+        ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+        if (received <= 0) return false;
+        carry.append(buffer, received);
+    }
+    return true;
+}
 
-        sf::Text title;
-        title.setFont(font);
-        title.setCharacterSize(24);
-        title.setFillColor(sf::Color::White);
-        title.setPosition(50, 20);
+/**
+ * Drives a running query server with pipelined requests (about 90% reads) from several
+ * connections and reports latency percentiles and throughput.
+ */
+int runLoadGenerator(const string& socketPath, int connections, int requestsPerConnection, int pipelineDepth) {
+    int probe = connectToServer(socketPath);
+    if (probe < 0) {
+        cerr << "Error: Could not connect to " << socketPath << endl;
+        return 1;
+    }
+    string carry;
+    vector<string> reply;
+    exchangeBatch(probe, "STUDENTS\n", 1, carry, reply);
+    close(probe);
+
+    vector<string> students;
+    stringstream ss(reply.empty() ? "" : reply[0]);
+    string field;
+    getline(ss, field, '\t');
+    getline(ss, field, '\t');
+    while (getline(ss, field, '\t')) {
+        students.push_back(field);
+    }
+    if (students.empty()) {
+        cerr << "Error: Server has no transcripts loaded" << endl;
+        return 1;
+    }
 
-        sf::Text subtitle;
-        subtitle.setFont(font);
-        subtitle.setCharacterSize(18);
-        subtitle.setFillColor(sf::Color(200, 200, 200));
-        subtitle.setPosition(50, 60);
+    vector<vector<double>> latencies(connections);
+    atomic<int> failures(0);
+    auto start = chrono::steady_clock::now();
+
+    vector<thread> clients;
+    for (int c = 0; c < connections; ++c) {
+        clients.emplace_back([&, c]() {
+            int fd = connectToServer(socketPath);
+            if (fd < 0) {
+                ++failures;
+                return;
+            }
+            mt19937 rng(c);
+            string clientCarry;
+            for (int done = 0; done < requestsPerConnection; done += pipelineDepth) {
+                int batchSize = min(pipelineDepth, requestsPerConnection - done);
+                string batch;
+                for (int i = 0; i < batchSize; ++i) {
+                    const string& student = students[rng() % students.size()];
+                    switch (rng() % 10) {
+                        case 0: batch += "ADD\t" + student + "\t999999\tLOAD 999\tLoad Test\t3\tA\n"; break;
+                        case 1: batch += "DELETE\t" + student + "\t999999\tLOAD 999\n"; break;
+                        case 2: case 3: batch += "COURSES\t" + student + "\n"; break;
+                        default: batch += "GPA\t" + student + "\n"; break;
+                    }
+                }
 
-        if (currentState == STATE_MAIN_MENU) {
-            title.setString("Transcript Manager: Main Menu");
-            subtitle.setString("Student: " + transcript.studentName + " | Cumulative GPA: " + 
-                                to_string(round(transcript.calculateCumulativeGPA() * 100) / 100.0f));
-            window.draw(title);
-            window.draw(subtitle);
-            
-            // List of semesters (for quick access)
-            float y = 500.0f;
-            drawText(window, "Existing Semesters (Click to Enter):", 50, y, 16, sf::Color::Yellow);
-            y += 30;
-            for (const auto& sem : transcript.semesters) {
-                drawText(window, sem.semesterID, 50, y, 14, sf::Color::White);
-                y += 25;
+                vector<string> replies;
+                auto sentAt = chrono::steady_clock::now();
+                if (!exchangeBatch(fd, batch, batchSize, clientCarry, replies)) {
+                    ++failures;
+                    break;
+                }
+                chrono::duration<double, micro> latency = chrono::steady_clock::now() - sentAt;
+                for (int i = 0; i < batchSize; ++i) {
+                    latencies[c].push_back(latency.count());
+                }
             }
+            close(fd);
+        });
+    }
+    for (auto& client : clients) {
+        client.join();
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
 
-        } else if (currentState == STATE_VIEW_SUMMARY) {
-            if (!currentSemesterID.empty() && currentSemesterID != "ALL") {
-                // Viewing a single semester
-                title.setString("Semester Details: " + currentSemesterID);
-                subtitle.setString("Click on 'Back' or a semester ID to return.");
+    vector<double> all;
+    for (const auto& perConnection : latencies) {
+        all.insert(all.end(), perConnection.begin(), perConnection.end());
+    }
+    if (all.empty()) {
+        cerr << "Error: No requests completed" << endl;
+        return 1;
+    }
+    sort(all.begin(), all.end());
+
+    cout << fixed << setprecision(1);
+    cout << "Load test: " << connections << " connections x " << requestsPerConnection
+         << " requests, pipeline depth " << pipelineDepth << endl;
+    cout << "  completed   " << all.size() << " (" << failures.load() << " connection failures)" << endl;
+    cout << "  p50 latency " << all[all.size() / 2] << " us" << endl;
+    cout << "  p99 latency " << all[min(all.size() - 1, all.size() * 99 / 100)] << " us" << endl;
+    cout << "  throughput  " << all.size() / elapsed.count() << " requests/s" << endl;
+    return 0;
+}
+
+/**
+ * Inspects a history file:
+ *   stats                         versions and storage compared with full copies
+ *   show <version>                print that version as transcript CSV
+ *   at <YYYY-MM-DD | unix time>   print the version in effect at the end of that day / time
+ *   record <transcript.csv> [date] append a CSV as a new version dated <date>, or the file's
+ *                                 modification time (e.g. to import dated copies oldest first)
+ */
+
+// Parses YYYY-MM-DD (local midnight, or 23:59:59 with endOfDay) or a unix time; throws on bad input
+time_t parseHistoryTime(const string& text, bool endOfDay) {
+    if (text.find('-') == string::npos) {
+        return (time_t)stoll(text);
+    }
+    tm date = {};
+    istringstream input(text);
+    input >> get_time(&date, "%Y-%m-%d");
+    if (input.fail()) {
+        throw invalid_argument("date");
+    }
+    if (endOfDay) {
+        date.tm_hour = 23;
+        date.tm_min = 59;
+        date.tm_sec = 59;
+    }
+    date.tm_isdst = -1;
+    return mktime(&date);
+}
+
+int runHistoryCommand(const string& historyFile, const vector<string>& args) {
+    TranscriptHistory history(historyFile);
+    string command = args.empty() ? "stats" : args[0];
+
+    if (command == "stats") {
+        uintmax_t stored = history.historyBytes();
+        uintmax_t fullCopies = history.fullCopyBytes();
+        cout << history.versionCount() << " version(s)" << endl;
+        cout << "  history file " << stored << " bytes" << endl;
+        cout << "  full copies  " << fullCopies << " bytes" << endl;
+        if (fullCopies > 0) {
+            cout << "  saved        " << (long long)fullCopies - (long long)stored << " bytes ("
+                 << fixed << setprecision(1) << 100.0 * (1.0 - double(stored) / fullCopies) << "%)" << endl;
+        }
+        return 0;
+    }
+
+    if (command == "record" && args.size() > 1) {
+        time_t savedAt;
+        struct stat info;
+        try {
+            if (args.size() > 2) {
+                savedAt = parseHistoryTime(args[2], false);
+            } else if (stat(args[1].c_str(), &info) == 0) {
+                savedAt = info.st_mtime;
             } else {
-                // Viewing the full transcript
-                title.setString("Full Transcript Summary");
-                subtitle.setString("Student: " + transcript.studentName + " | Cumulative GPA: " + 
-                                to_string(round(transcript.calculateCumulativeGPA() * 100) / 100.0f));
-                currentSemesterID = "ALL"; // Clear focus
+                cerr << "Error: Could not open " << args[1] << endl;
+                return 1;
             }
-            window.draw(title);
-            window.draw(subtitle);
-            
-            drawSummary(window);
+        } catch (const std::exception& e) {
+            cerr << "Error: Invalid date" << endl;
+            return 1;
+        }
+        int latest = history.versionCount();
+        if (latest > 0 && savedAt < history.savedAt(latest)) {
+            cerr << "Error: Date is earlier than version " << latest << "; import copies oldest first" << endl;
+            return 1;
+        }
 
-            buttons.emplace_back("Back to Main Menu", font, 50, 650, 150, 30); // Back button below scroll area
+        Transcript transcript;
+        transcript.loadFromCSV(args[1]);
+        int version = history.record(transcript, savedAt);
+        cout << (version > 0 ? "Recorded version " + to_string(version) : string("No changes to record")) << endl;
+        return 0;
+    }
 
-        } else if (currentState == STATE_INPUT_STUDENT_NAME) {
-            title.setString("Enter Student Name");
-            window.draw(title);
+    int version = -1;
+    try {
+        if (command == "show" && args.size() > 1) {
+            version = stoi(args[1]);
+        } else if (command == "at" && args.size() > 1) {
+            version = history.versionAt(parseHistoryTime(args[1], true));
+        } else {
+            cerr << "Usage: --history <file> [stats | show <version> | at <date> | record <csv> [date]]" << endl;
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        cerr << "Error: Invalid version or date" << endl;
+        return 1;
+    }
 
-        } else if (currentState == STATE_ADD_SEMESTER) {
-            title.setString("Add New Semester");
-            window.draw(title);
+    Transcript transcript;
+    if (!history.reconstruct(version, transcript)) {
+        cerr << "Error: No such version" << endl;
+        return 1;
+    }
+    transcript.writeCSV(cout);
+    return 0;
+}
 
-        } else if (currentState == STATE_DELETE_SEMESTER) {
-            title.setString("Delete Semester");
-            window.draw(title);
+// Benchmarks
 
-        } else if (currentState == STATE_SEMESTER_MENU) {
-            title.setString("Semester Manager: " + currentSemesterID);
-            
-            Semester* sem = transcript.findSemester(currentSemesterID);
-            if (sem) {
-                float gpa = round(sem->calculateSemesterGPA() * 100) / 100.0f;
-                subtitle.setString("Semester GPA: " + to_string(gpa));
+/**
+ * Builds a randomized transcript for benchmarks: a handful of semesters drawn from a fixed
+ * catalog, with roughly one course in eight being a repeat of an earlier attempt.
+ */
+Transcript makeSyntheticTranscript(mt19937& rng, int semesterCount, int coursesPerSemester) {
+    static const vector<string> grades = {"A", "A-", "B+", "B", "B-", "C+", "C", "C-", "D", "F", "W", "P"};
+    static const vector<string> prefixes = {"CSC", "MAT", "PHY", "ENG", "HIS"};
+    uniform_int_distribution<int> gradeDist(0, (int)grades.size() - 1);
+    uniform_int_distribution<int> prefixDist(0, (int)prefixes.size() - 1);
+    uniform_int_distribution<int> numberDist(101, 499);
+    uniform_int_distribution<int> creditDist(1, 4);
+    uniform_int_distribution<int> repeatDist(0, 7);
+
+    Transcript transcript;
+    transcript.studentName = "Student " + to_string(rng() % 100000);
+    vector<string> takenCodes;
+    for (int s = 0; s < semesterCount; ++s) {
+        Semester semester{to_string(2020 + s / 2) + (s % 2 == 0 ? "10" : "40"), {}};
+        for (int c = 0; c < coursesPerSemester; ++c) {
+            string code;
+            if (!takenCodes.empty() && repeatDist(rng) == 0) {
+                code = takenCodes[rng() % takenCodes.size()];
             } else {
-                subtitle.setString("Error: Semester not found.");
+                code = prefixes[prefixDist(rng)] + " " + to_string(numberDist(rng));
+                takenCodes.push_back(code);
+            }
+            semester.courses.push_back({code, "Course " + code, creditDist(rng), grades[gradeDist(rng)]});
+        }
+        transcript.semesters.push_back(semester);
+    }
+    return transcript;
+}
+
+// The original hard-coded cumulative GPA, kept as the benchmark baseline
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+double legacyCumulativeGPA(const Transcript& transcript) {
+    map<string, pair<string, Course>> latestCourses;
+
+    for (const auto& semester : transcript.semesters) {
+        for (const auto& course : semester.courses) {
+            if (latestCourses.find(course.courseCode) == latestCourses.end()) {
+                latestCourses[course.courseCode] = {semester.semesterID, course};
+            } else if (semester.semesterID > latestCourses[course.courseCode].first) {
+                latestCourses[course.courseCode] = {semester.semesterID, course};
             }
-            window.draw(title);
-            window.draw(subtitle);
+        }
+    }
 
-        } else if (currentState == STATE_ADD_COURSE) {
-            title.setString("Add Course to " + currentSemesterID);
-            window.draw(title);
-            drawText(window, "Note: Credits must be a whole number (e.g., 3).", 50, 100, 14, sf::Color(255, 150, 150));
+    double totalPoints = 0.0;
+    int totalCredits = 0;
+    for (const auto& entry : latestCourses) {
+        const Course& course = entry.second.second;
+        double points = course.getGradePoints();
+        if (points >= 0) {
+            totalPoints += points * course.credits;
+            totalCredits += course.credits;
+        }
+    }
+    return totalCredits == 0 ? 0.0 : totalPoints / totalCredits;
+}
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+template <class Fn>
+double timeTranscripts(const vector<Transcript>& cohort, int rounds, Fn&& fn, double& checksum) {
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        for (const auto& transcript : cohort) {
+            checksum += fn(transcript);
+        }
+    }
+    chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count() / (double(cohort.size()) * rounds);
+}
+
+int runGPABenchmark(int studentCount) {
+    mt19937 rng(319);
+    vector<Transcript> cohort;
+    cohort.reserve(studentCount);
+    for (int i = 0; i < studentCount; ++i) {
+        cohort.push_back(makeSyntheticTranscript(rng, 8, 5));
+    }
 
-        } else if (currentState == STATE_DELETE_COURSE) {
-            title.setString("Delete Course from " + currentSemesterID);
-            window.draw(title);
-        } else if (currentState == STATE_MESSAGE) {
-             title.setString("Notification");
-             window.draw(title);
-             drawText(window, messageText, 50, 200, 18, sf::Color::Cyan);
-        } else if (currentState == STATE_MESSAGE_SEM) {
-             title.setString("Notification");
-             window.draw(title);
-             drawText(window, messageText, 50, 200, 18, sf::Color::Cyan);
+    for (const auto& transcript : cohort) {
+        if (transcript.calculateCumulativeGPA() != legacyCumulativeGPA(transcript)) {
+            cerr << "Mismatch: LatestAttemptPolicy differs from the legacy GPA for " << transcript.studentName << endl;
+            return 1;
         }
+    }
 
-        // Draw general UI elements (buttons/inputs)
-        for (const auto& btn : buttons) {
-            btn.draw(window);
+    // Averaging repeats changes the GPA but a course passed twice earns its credits once
+    Transcript repeated;
+    repeated.semesters = {{"202010", {{"CSC 101", "Intro", 3, "A"}, {"MAT 101", "Calc", 4, "P"}}},
+                          {"202040", {{"CSC 101", "Intro", 3, "B"}, {"MAT 101", "Calc", 4, "P"}}}};
+    GPATotals averaged = repeated.evaluateGPA<AverageRepeatsPolicy>();
+    if (averaged.creditsEarned() != 7 || averaged.gpa() != 3.5 ||
+        repeated.evaluateGPA<PassFailCapPolicy<AverageRepeatsPolicy, 2>>().creditsEarned() != 5) {
+        cerr << "Mismatch: AverageRepeatsPolicy counts repeated credits more than once" << endl;
+        return 1;
+    }
+    for (const auto& transcript : cohort) {
+        map<string, bool> earned;
+        int expected = 0;
+        for (const auto& semester : transcript.semesters) {
+            for (const auto& course : semester.courses) {
+                if ((course.getGradePoints() > 0 || course.grade == "P") && !earned[course.courseCode]) {
+                    earned[course.courseCode] = true;
+                    expected += course.credits;
+                }
+            }
         }
-        for (const auto& input : inputs) {
-            input.draw(window);
+        if (transcript.evaluateGPA<AverageRepeatsPolicy>().creditsEarned() != expected) {
+            cerr << "Mismatch: AverageRepeatsPolicy credits earned for " << transcript.studentName << endl;
+            return 1;
         }
-        
-        window.display();
     }
 
-    void drawSummary(sf::RenderWindow& window) {
-        float currentY = 150.0f + viewScrollOffset;
-        const float rowHeight = 25.0f;
-        
-        // Define the area where content can be drawn (to hide content that scrolls off screen)
-        sf::View view(sf::FloatRect(0, 0, 800, 700)); // Default view
-        window.setView(view);
+    const int rounds = 5;
+    double checksum = 0.0;
+    cout << fixed << setprecision(1);
+    cout << "GPA policy benchmark: " << studentCount << " transcripts x " << rounds << " rounds (ns/transcript)" << endl;
+    cout << "  legacy (hard-coded)   " << timeTranscripts(cohort, rounds, legacyCumulativeGPA, checksum) << endl;
+    cout << "  LatestAttemptPolicy   " << timeTranscripts(cohort, rounds, [](const Transcript& t) {
+        return t.calculateCumulativeGPA<LatestAttemptPolicy>(); }, checksum) << endl;
+    cout << "  BestAttemptPolicy     " << timeTranscripts(cohort, rounds, [](const Transcript& t) {
+        return t.calculateCumulativeGPA<BestAttemptPolicy>(); }, checksum) << endl;
+    cout << "  AverageRepeatsPolicy  " << timeTranscripts(cohort, rounds, [](const Transcript& t) {
+        return t.calculateCumulativeGPA<AverageRepeatsPolicy>(); }, checksum) << endl;
+    cout << "  PassFailCapPolicy<12> " << timeTranscripts(cohort, rounds, [](const Transcript& t) {
+        return (double)t.evaluateGPA<PassFailCapPolicy<LatestAttemptPolicy, 12>>().creditsEarned(); }, checksum) << endl;
+    cout << "  (checksum " << checksum << ")" << endl;
+    return 0;
+}
 
-        // Clip/Scroll Area Rectangle (50, 100) to (750, 600)
-        sf::RectangleShape clipRect({700, 480});
-        clipRect.setPosition(50, 100);
-        clipRect.setFillColor(sf::Color(40, 40, 40));
-        window.draw(clipRect);
+/**
+ * Audits the given transcript CSVs (or a synthetic cohort when none are given) against a
+ * requirements file using every core, printing per-student results and throughput.
+ */
+int runBatchAudit(const string& requirementsFile, const vector<string>& transcriptFiles) {
+    DegreeRequirements requirements;
+    if (!requirements.loadFromCSV(requirementsFile)) {
+        cerr << "Error: Could not open " << requirementsFile << endl;
+        return 1;
+    }
 
-        // Adjust view to enable scrolling within the visible area
-        sf::View scrollableView = window.getView();
-        scrollableView.setViewport(sf::FloatRect(50.0f / 800.0f, 100.0f / 700.0f, 700.0f / 800.0f, 500.0f / 700.0f));
-        scrollableView.setCenter(400, 350 - viewScrollOffset);
-        window.setView(scrollableView);
+    vector<Transcript> cohort;
+    if (transcriptFiles.empty()) {
+        mt19937 rng(319);
+        for (int i = 0; i < 200000; ++i) {
+            cohort.push_back(makeSyntheticTranscript(rng, 8, 5));
+        }
+    } else {
+        for (const auto& filename : transcriptFiles) {
+            cohort.emplace_back();
+            cohort.back().loadFromCSV(filename);
+        }
+    }
 
+    CourseCatalog catalog;
+    CompiledAudit audit(requirements, catalog);
+    for (const auto& transcript : cohort) {
+        catalog.addTranscript(transcript);
+    }
 
-        const vector<Semester>* semestersToDisplay = &transcript.semesters;
-        if (currentSemesterID != "ALL") {
-            Semester* sem = transcript.findSemester(currentSemesterID);
-            if (sem) {
-                semestersToDisplay = new vector<Semester>{*sem};
+    auto start = chrono::steady_clock::now();
+    vector<AuditResult> results = auditCohort(audit, catalog, cohort);
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    size_t satisfied = 0;
+    for (size_t i = 0; i < results.size(); ++i) {
+        satisfied += results[i].satisfied;
+        if (transcriptFiles.empty()) continue;
+
+        cout << transcriptFiles[i] << " (" << cohort[i].studentName << "): "
+             << (results[i].satisfied ? "SATISFIED" : "INCOMPLETE") << endl;
+        for (const auto& line : describeAudit(requirements, results[i])) {
+            if (!line.met) {
+                cout << "  missing " << line.text << endl;
             }
         }
+    }
 
-        for (const auto& semester : *semestersToDisplay) {
-            // Semester Header
-            drawText(window, "--- Semester: " + semester.semesterID + " ---", 50, currentY, 18, sf::Color::Yellow);
-            currentY += rowHeight;
+    cout << satisfied << " / " << results.size() << " transcripts satisfy " << requirements.programName << endl;
+    cout << "Audited " << results.size() << " transcripts in " << elapsed.count() * 1000.0 << " ms on "
+         << max(1u, thread::hardware_concurrency()) << " threads ("
+         << (uint64_t)(results.size() / max(elapsed.count(), 1e-9)) << " transcripts/s)" << endl;
+    return 0;
+}
+
+int runCohortBenchmark(int studentCount) {
+    mt19937 rng(319);
+    vector<Transcript> cohort;
+    cohort.reserve(studentCount);
+    for (int i = 0; i < studentCount; ++i) {
+        cohort.push_back(makeSyntheticTranscript(rng, 8, 5));
+    }
 
-            // Column Headers
-            drawTable(window, currentY, "Course", "Name", "Credits", "Grade", sf::Color(150, 150, 150));
-            currentY += rowHeight;
-            
-            // Course Rows
-            for (const auto& course : semester.courses) {
-                drawTable(window, currentY, 
-                          course.courseCode, 
-                          course.courseName.length() > 25 ? course.courseName.substr(0, 22) + "..." : course.courseName, // Truncate long names
-                          to_string(course.credits), 
-                          course.grade,
-                          sf::Color::White);
-                currentY += rowHeight;
-            }
+    CohortColumns columns;
+    columns.build(cohort);
+    const double records = (double)columns.recordCount();
 
-            // Semester GPA
-            float gpa = round(semester.calculateSemesterGPA() * 100) / 100.0f;
-            drawText(window, "Semester GPA: " + to_string(gpa), 50, currentY, 16, sf::Color::Green);
-            currentY += rowHeight * 1.5f;
+    // Baseline: the object graph path used by the UI
+    vector<double> expectedSemesters, expectedCumulative;
+    auto start = chrono::steady_clock::now();
+    for (const auto& transcript : cohort) {
+        for (const auto& semester : transcript.semesters) {
+            expectedSemesters.push_back(semester.calculateSemesterGPA());
         }
+        expectedCumulative.push_back(transcript.calculateCumulativeGPA());
+    }
+    chrono::duration<double> baseline = chrono::steady_clock::now() - start;
 
-        // Restore original view for drawing elements outside the scroll area
-        window.setView(view);
+    cout << fixed << setprecision(1);
+    cout << "Cohort GPA benchmark: " << studentCount << " students, " << (size_t)records << " course records" << endl;
+    cout << "  Semester/Transcript methods " << records / baseline.count() / 1e6 << " M records/s" << endl;
 
-        // Draw button outside the scroll area
-        buttons.clear();
-        buttons.emplace_back("Back to Main Menu", font, 50, 650, 150, 30);
+    vector<pair<string, GPAKernel>> kernels = {{"scalar", GPAKernel::Scalar}};
+#if defined(__x86_64__) || defined(__i386__)
+    kernels.push_back({"sse2", GPAKernel::SSE2});
+    if (__builtin_cpu_supports("avx2")) {
+        kernels.push_back({"avx2", GPAKernel::AVX2});
     }
-
-    // Helper to draw a single line of text with custom color/size
-    void drawText(sf::RenderWindow& window, const string& str, float x, float y, unsigned int size, const sf::Color& color) {
-        sf::Text txt(str, font, size);
-        txt.setFillColor(color);
-        txt.setPosition(x, y);
-        window.draw(txt);
+#endif
+
+    // Empty semesters and transcripts next to non-empty ones exercise the masked lanes at the column ends
+    mt19937 edgeRng(7);
+    vector<Transcript> edgeCohort = {makeSyntheticTranscript(edgeRng, 2, 4), makeSyntheticTranscript(edgeRng, 3, 0),
+                                     makeSyntheticTranscript(edgeRng, 0, 0), makeSyntheticTranscript(edgeRng, 1, 6)};
+    edgeCohort[0].semesters[1].courses.clear();
+    edgeCohort[3].semesters.push_back({"209910", {}});
+    for (size_t count = 1; count <= edgeCohort.size(); ++count) {
+        vector<Transcript> shape(edgeCohort.begin(), edgeCohort.begin() + count);
+        CohortColumns edgeColumns;
+        edgeColumns.build(shape);
+        vector<double> edgeSemesters, edgeCumulative;
+        for (const auto& transcript : shape) {
+            for (const auto& semester : transcript.semesters) {
+                edgeSemesters.push_back(semester.calculateSemesterGPA());
+            }
+            edgeCumulative.push_back(transcript.calculateCumulativeGPA());
+        }
+        for (const auto& kernel : kernels) {
+            vector<double> semesterGPAs, cumulativeGPAs;
+            computeCohortGPAs(edgeColumns, semesterGPAs, cumulativeGPAs, kernel.second);
+            if (semesterGPAs != edgeSemesters || cumulativeGPAs != edgeCumulative) {
+                cerr << "Mismatch: " << kernel.first << " kernel differs on empty semesters" << endl;
+                return 1;
+            }
+        }
     }
 
-    // Helper to draw a formatted table row
-    void drawTable(sf::RenderWindow& window, float y, const string& col1, const string& col2, const string& col3, const string& col4, const sf::Color& color) {
-        drawText(window, col1, 50, y, 14, color);     // Course Code
-        drawText(window, col2, 170, y, 14, color);    // Name
-        drawText(window, col3, 470, y, 14, color);    // Credits
-        drawText(window, col4, 570, y, 14, color);    // Grade
+    const int rounds = 5;
+    for (const auto& kernel : kernels) {
+        vector<double> semesterGPAs, cumulativeGPAs;
+        start = chrono::steady_clock::now();
+        for (int r = 0; r < rounds; ++r) {
+            computeCohortGPAs(columns, semesterGPAs, cumulativeGPAs, kernel.second);
+        }
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        if (semesterGPAs != expectedSemesters || cumulativeGPAs != expectedCumulative) {
+            cerr << "Mismatch: " << kernel.first << " kernel differs from the member functions" << endl;
+            return 1;
+        }
+        cout << "  " << left << setw(27) << kernel.first + " kernel" << right << " "
+             << records * rounds / elapsed.count() / 1e6 << " M records/s (exact match)" << endl;
     }
-};
+    return 0;
+}
 
 // Main Function
 
-int main() {
+int main(int argc, char* argv[]) {
     // Prevent console output from the original code
     ios_base::sync_with_stdio(false);
     cin.tie(NULL);
 
+    if (const char* tracePath = getenv("TRANSCRIPT_TRACE")) {
+        Tracer::start(tracePath);
+    }
+
+    vector<string> args(argv + 1, argv + argc);
+    if (!args.empty() && args[0] == "--bench-gpa") {
+        return runGPABenchmark(args.size() > 1 ? stoi(args[1]) : 20000);
+    }
+    if (!args.empty() && args[0] == "--bench-cohort") {
+        return runCohortBenchmark(args.size() > 1 ? stoi(args[1]) : 50000);
+    }
+    if (!args.empty() && args[0] == "--serve") {
+        string socketPath = args.size() > 1 ? args[1] : "transcript.sock";
+        vector<string> files(args.size() > 2 ? args.begin() + 2 : args.end(), args.end());
+        return runQueryServer(socketPath, files.empty() ? vector<string>{"transcript.csv"} : files);
+    }
+    if (!args.empty() && args[0] == "--loadgen") {
+        int counts[3] = {4, 20000, 16}; // Connections, requests per connection, pipeline depth
+        for (size_t i = 2; i < args.size() && i < 5; ++i) {
+            try {
+                counts[i - 2] = stoi(args[i]);
+            } catch (const std::exception& e) {
+                counts[i - 2] = 0;
+            }
+        }
+        if (counts[0] <= 0 || counts[1] <= 0 || counts[2] <= 0) {
+            cerr << "Usage: --loadgen [socket] [connections > 0] [requests per connection > 0] [pipeline depth > 0]" << endl;
+            return 1;
+        }
+        return runLoadGenerator(args.size() > 1 ? args[1] : "transcript.sock", counts[0], counts[1], counts[2]);
+    }
+    if (args.size() > 1 && args[0] == "--history") {
+        return runHistoryCommand(args[1], vector<string>(args.begin() + 2, args.end()));
+    }
+    if (args.size() > 2 && args[0] == "--export-summary") {
+        TranscriptApp exporter(true);
+        return exporter.exportSummaries(vector<string>(args.begin() + 2, args.end()), args[1]);
+    }
+    if (args.size() > 1 && args[0] == "--audit") {
+        return runBatchAudit(args[1], vector<string>(args.begin() + 2, args.end()));
+    }
+
+    if (args.size() > 1 && args[0] == "--replay") {
+        double maxP99Us = 0.0;
+        if (args.size() > 3 && args[2] == "--max-p99-us") {
+            maxP99Us = stod(args[3]);
+        }
+        TranscriptApp replayer(true);
+        return replayer.replay(args[1], maxP99Us);
+    }
+
     TranscriptApp app;
+    if (args.size() > 1 && args[0] == "--record") {
+        app.startRecording(args[1]);
+    }
     app.run();
 
     return 0;
-}
\ No newline at end of file
+}